@@ -29,21 +29,38 @@ test_file() {
 	Stdout="$Executable.stdout"
 	Stderr="$Executable.stderr"
 
-	let ++Test_Count
+	# Each `# flags: <compiler flags>` line runs test once more, compiled with given flags and expecting
+	# the same output. Runs go in order, so run with `--profile-generate` may be followed by `--profile-use`.
+	Flags=("")
+	while IFS= read -r Line; do
+		Flags+=("${Line#\# flags:}")
+	done < <(grep '^# flags:' "$Stacky_File")
 
-	"$Compiler" run "$Stacky_File" > .stdout 2> .stderr
+	rm -f "$Executable.profile"
 
-	Test_Passed=1
+	for Test_Flags in "${Flags[@]}"; do
+		let ++Test_Count
 
-	if ! diff -p -N "$Stdout" .stdout; then
-		Test_Passed=0
-	fi
+		"$Compiler" run $Test_Flags "$Stacky_File" > .stdout 2> .stderr
 
-	if ! diff -N "$Stderr" .stderr; then
-		Test_Passed=0
-	fi
+		Test_Passed=1
 
-	let Passed+="$Test_Passed"
+		if ! diff -p -N "$Stdout" .stdout; then
+			Test_Passed=0
+		fi
+
+		if ! diff -N "$Stderr" .stderr; then
+			Test_Passed=0
+		fi
+
+		if [ "$Test_Passed" -eq 0 -a -n "$Test_Flags" ]; then
+			echo "### Failed $Stacky_File with flags:$Test_Flags"
+		fi
+
+		let Passed+="$Test_Passed"
+	done
+
+	rm -f "$Executable.profile"
 }
 
 test_directory() {
@@ -16,6 +16,7 @@ void help(po::options_description const& desc)
 {
 	std::cout << "usage: stacky build [options] <sources...>\n";
 	std::cout << "       stacky run   [options] <sources...> [-- <args...>]\n";
+	std::cout << "       stacky superopt [--length <n>]\n";
 	std::cout << desc << '\n';
 	exit(1);
 }
@@ -49,6 +50,16 @@ try {
 	po::options_description build("Build options");
 	build.add_options()
 		("output,o", po::value<std::string>()->value_name("<path>"), "file name of produced executable")
+		("optimize,O", po::value<std::string>()->value_name("<level>")->default_value("2"), "2 optimizes for speed, s for size of executable")
+		("unroll", po::value<unsigned>()->value_name("<n>")->default_value(4), "number of copies of counted loop body per iteration, 1 disables unrolling")
+		("avx2", "vectorize loops with 256 bit AVX2 instructions instead of SSE2")
+		("profile-generate", "instrument executable to append execution counts to <executable>.profile at exit")
+		("profile-use", po::value<std::string>()->value_name("<path>"), "optimize for execution counts from profile file")
+	;
+
+	po::options_description superopt("Superoptimizer options");
+	superopt.add_options()
+		("length", po::value<unsigned>()->value_name("<n>")->default_value(3), "longest sequence of operations that is optimized")
 	;
 
 	po::options_description config("Configuration");
@@ -58,7 +69,8 @@ try {
 
 	po::options_description debug("Debugging");
 	debug.add_options()
-		("dump-effects", "dump all defined words types")
+		("dump-effects", "dump all defined words types and purity of functions")
+		("dump-ssa", "dump SSA form of optimized functions")
 		("control-flow", "generate control flow graph of a program")
 		("control-flow-for", po::value<std::string>()->value_name("<function>"), "generate control flow graph of a function")
 	;
@@ -75,7 +87,7 @@ try {
 	cmdline_options.add(common).add(config).add(debug).add(hidden);
 
 	po::options_description visible;
-	visible.add(common).add(build).add(config).add(debug);
+	visible.add(common).add(build).add(superopt).add(config).add(debug);
 
 
 	po::parsed_options parsed = po::command_line_parser(cmdline)
@@ -98,6 +110,11 @@ try {
 
 	if (command == "build" || (run_mode = command == "run")) {
 		po::store(po::command_line_parser(opts).options(build).run(), vm);
+	} else if (command == "superopt") {
+		po::store(po::command_line_parser(opts).options(superopt).run(), vm);
+		superopt_mode = true;
+		superopt_length = vm["length"].as<unsigned>();
+		return;
 	} else {
 		error_fatal(std::format("Unrecognized command: {}", command));
 	}
@@ -126,8 +143,29 @@ try {
 	verbose   = vm.count("verbose");
 	typecheck = vm.count("check");
 	dump_words_effects = vm.count("dump-effects");
+	dump_ssa  = vm.count("dump-ssa");
+	unroll_factor = std::max(vm["unroll"].as<unsigned>(), 1u);
+
+	if (auto const& level = vm["optimize"].as<std::string>(); level == "s") {
+		optimize_size = true;
+		// Unrolled loops are larger, unless user asked for them explicitly
+		if (vm["unroll"].defaulted())
+			unroll_factor = 1;
+	} else if (level != "2") {
+		error_fatal(std::format("Unrecognized optimization level: {}", level));
+	}
+	avx2 = vm.count("avx2");
 	output_colors = !vm.count("no-colors") && isatty(STDOUT_FILENO);
 
+	if (profile_generate = vm.count("profile-generate")) {
+		// Executable may be run from any directory
+		profile_output = fs::absolute(executable);
+		profile_output += ".profile";
+	}
+
+	if (vm.count("profile-use"))
+		profile_input = vm["profile-use"].as<std::string>();
+
 	if (control_flow_graph = vm.count("control-flow")) {
 		control_flow = executable;
 		control_flow += ".dot";
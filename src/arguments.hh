@@ -13,16 +13,26 @@ extern struct Arguments
 	std::filesystem::path                executable;
 	std::filesystem::path                assembly;
 	std::filesystem::path                control_flow;
+	std::filesystem::path                profile_output;
+	std::filesystem::path                profile_input;
 
 	std::string control_flow_function;
 
+	unsigned superopt_length = 3;
+	unsigned unroll_factor   = 4;
+
 	bool warn_redefinitions = true;
 	bool verbose            = false;
 	bool typecheck          = false;
 	bool control_flow_graph = false;
 	bool run_mode           = false;
 	bool dump_words_effects = false;
+	bool dump_ssa           = false;
+	bool superopt_mode      = false;
 	bool output_colors      = true;
+	bool profile_generate   = false;
+	bool optimize_size      = false;
+	bool avx2               = false;
 
 	void parse(int argc, char **argv);
 } compiler_arguments;
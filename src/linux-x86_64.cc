@@ -1,7 +1,15 @@
+#include "ssa.hh"
 #include "stacky.hh"
+#include "vectorizer.hh"
 
+#include <bit>
 #include <format>
 #include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
 
 #define Impl_Math(Op_Kind, Name, Implementation) \
 	case Intrinsic_Kind::Op_Kind: \
@@ -37,6 +45,9 @@ namespace linux::x86_64 {
 	auto asm_header(std::ostream &asm_file, Generation_Info const& geninfo)
 	{
 		asm_file << "BITS 64\n";
+		// Padding of aligned code is executed, so it is made of long nops
+		asm_file << "%use smartalign\n";
+		asm_file << "alignmode p6\n";
 
 		auto const label = [&](auto &v) -> auto& { return asm_file << '\t' << Symbol_Prefix << v.id << ": "; };
 
@@ -65,6 +76,13 @@ namespace linux::x86_64 {
 		asm_file << "segment .text\n";
 	}
 
+	// Padding before loop header is skipped when optimizing for size
+	auto emit_loop_alignment(std::ostream& asm_file)
+	{
+		if (!compiler_arguments.optimize_size)
+			asm_file << "	align 16\n";
+	}
+
 	auto emit_return(std::ostream& asm_file)
 	{
 		asm_file << "	sub qword [_stacky_callptr], 1\n";
@@ -74,9 +92,36 @@ namespace linux::x86_64 {
 		asm_file << "	ret\n";
 	}
 
+	static char const* const Register_B_By_Size[] = { "bl", "bx", "ebx", "rbx" };
+	static char const* const Register_D_By_Size[] = { "dl", "dx", "edx", "rdx" };
+	static char const* const Size_Names[] = { "byte", "word", "dword", "qword" };
+
+	// Size of memory access as log2 of bytes, based on name of `loadN` or `storeN` intrinsic
+	auto memory_access_size(Operation const& op) -> unsigned
+	{
+		assert(op.intrinsic == Intrinsic_Kind::Load || op.intrinsic == Intrinsic_Kind::Store);
+		switch (op.token.sval[op.intrinsic == Intrinsic_Kind::Load ? 4 : 5]) {
+			case '8': return 0;
+			case '1': return 1;
+			case '3': return 2;
+			case '6': return 3;
+			default: unreachable("Load and store intrinsics cannot have different name");
+		}
+	}
+
+	// Loads value of given size from memory operand into rbx, zero extended
+	auto emit_load(std::ostream& asm_file, unsigned offset, std::string_view address)
+	{
+		switch (offset) {
+		case 0:
+		case 1: asm_file << "	movzx rbx, " << Size_Names[offset] << ' ' << address << '\n'; break;
+		case 2: asm_file << "	mov ebx, " << address << '\n'; break;
+		default: asm_file << "	mov rbx, " << address << '\n'; break;
+		}
+	}
+
 	auto emit_intrinsic(Operation const& op, std::ostream& asm_file)
 	{
-		static char const* const Register_B_By_Size[] = { "bl", "bx", "ebx", "rbx" };
 
 		assert(op.kind == Operation::Kind::Intrinsic);
 		switch (op.intrinsic) {
@@ -111,6 +156,13 @@ namespace linux::x86_64 {
 			asm_file << "	call rax\n";
 			break;
 
+		case Intrinsic_Kind::Memory_Compare:
+		case Intrinsic_Kind::Memory_Copy:
+		case Intrinsic_Kind::Memory_Find:
+		case Intrinsic_Kind::Memory_Move:
+		case Intrinsic_Kind::Memory_Set:
+			unreachable("Bulk memory intrinsics are emitted by emit_bulk_memory");
+
 		Impl_Math(Add,          "add",          "add rax, rbx\n");
 		Impl_Math(Bitwise_And,  "bitwise and",  "and rax, rbx\n");
 		Impl_Math(Bitwise_Or,   "bitwise or",   "or rax, rbx\n");
@@ -226,32 +278,17 @@ namespace linux::x86_64 {
 
 		case Intrinsic_Kind::Load:
 			{
-				auto offset = 0u;
-				switch (op.token.sval[4]) {
-					case '8': offset = 0; break;
-					case '1': offset = 1; break;
-					case '3': offset = 2; break;
-					case '6': offset = 3; break;
-					default: unreachable("Load intrinsic cannot have different name");
-				}
+				auto const offset = memory_access_size(op);
 				asm_file << "	;; load" << (8 << offset) << "\n";
 				asm_file << "	pop rax\n";
-				asm_file << "	xor rbx, rbx\n";
-				asm_file << "	mov " << Register_B_By_Size[offset] << ", [rax]\n";
+				emit_load(asm_file, offset, "[rax]");
 				asm_file << "	push rbx\n";
 			}
 			break;
 
 		case Intrinsic_Kind::Store:
 			{
-				auto offset = 0u;
-				switch (op.token.sval[5]) {
-					case '8': offset = 0; break;
-					case '1': offset = 1; break;
-					case '3': offset = 2; break;
-					case '6': offset = 3; break;
-					default: unreachable("Store intrinsic cannot have different name");
-				}
+				auto const offset = memory_access_size(op);
 				asm_file << "	;; store" << (8 << offset) << "\n";
 				asm_file << "	pop rbx\n";
 				asm_file << "	pop rax\n";
@@ -268,6 +305,8 @@ namespace linux::x86_64 {
 				asm_file << "	;; syscall" << syscall_count << '\n';
 				for (unsigned i = 0; i <= syscall_count; ++i)
 					asm_file << "	pop " << regs[i] << '\n';
+				if (compiler_arguments.profile_generate)
+					asm_file << "	call _stacky_profile_exit\n";
 				asm_file << "	syscall\n";
 				asm_file << "	push rax\n";
 			}
@@ -275,110 +314,2498 @@ namespace linux::x86_64 {
 		}
 	}
 
-	auto generate_instructions([[maybe_unused]] Generation_Info const& geninfo, std::vector<Operation> const& ops, std::ostream& asm_file, std::string_view instr_prefix, std::string_view name = {}) -> void
+	// Checks if operation at given index is the last thing executed before function returns,
+	// following unconditional transfers of control (`end` of `if`, `else`, `return`)
+	auto is_tail_position(std::vector<Operation> const& ops, unsigned i) -> bool
 	{
-		unsigned i = 0;
-		for (auto ops_it = std::cbegin(ops); ops_it != std::cend(ops); ++ops_it, ++i) {
-			auto const& op = *ops_it;
-			if (geninfo.jump_targets_lookup.contains({ name, i }))
-				asm_file << instr_prefix << i << ":\n";
-
-			switch (op.kind) {
-			case Operation::Kind::Intrinsic:
-				emit_intrinsic(op, asm_file);
-				break;
-			case Operation::Kind::Cast:
-				asm_file << "	;; cast " << op.token.sval << "\n";
-				break;
-			case Operation::Kind::Call_Symbol:
-				asm_file << "	;; call symbol\n";
-				asm_file << "	call " << Function_Prefix << op.ival << '\n';
-				break;
-			case Operation::Kind::Push_Symbol:
-				asm_file << "	;; push symbol\n";
-				asm_file << "	push " << op.symbol_prefix << op.ival << '\n';
-				break;
-			case Operation::Kind::Push_Int:
-				asm_file << "	;; push int\n";
-				asm_file << "	mov rax, " << op.ival << '\n';
-				asm_file << "	push rax\n";
-				break;
+		for (auto next = i + 1; next < ops.size();) {
+			switch (auto const& op = ops[next]; op.kind) {
 			case Operation::Kind::Return:
-				asm_file << "	;; return\n";
-				asm_file << "	jmp " << instr_prefix << ops.size() << '\n';
+				return true;
+			case Operation::Kind::Cast:
+				++next;
 				break;
+			case Operation::Kind::Else:
 			case Operation::Kind::End:
-				assert(op.jump != Operation::Empty_Jump);
-				asm_file << "	;; end\n";
-				if (i + 1 != op.jump)
-					asm_file << "	jmp " << instr_prefix << op.jump << '\n';
+				// `end` of a loop jumps back to `while`, which is not a tail position
+				if (op.jump <= next)
+					return false;
+				next = op.jump;
 				break;
-			case Operation::Kind::Do:
-			case Operation::Kind::If:
-				assert(op.jump != Operation::Empty_Jump);
-				asm_file << "	;; if | do\n";
-				asm_file << "	pop rax\n";
-				asm_file << "	test rax, rax\n";
-				asm_file << "	jz " << instr_prefix << op.jump << '\n';
+			default:
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Checks if any operation in range (first, last] is target of some jump
+	auto has_jump_target_inside(Generation_Info const& geninfo, std::string_view name, unsigned first, unsigned last) -> bool
+	{
+		auto const it = geninfo.jump_targets_lookup.upper_bound({ name, first });
+		return it != std::cend(geninfo.jump_targets_lookup) && it->function == name && it->jump <= last;
+	}
+
+	struct Condition_Code
+	{
+		char const* when_true;
+		char const* when_false;
+	};
+
+	auto condition_code(Intrinsic_Kind kind) -> std::optional<Condition_Code>
+	{
+		switch (kind) {
+		case Intrinsic_Kind::Equal:      return Condition_Code { "e",  "ne" };
+		case Intrinsic_Kind::Not_Equal:  return Condition_Code { "ne", "e"  };
+		case Intrinsic_Kind::Less:       return Condition_Code { "b",  "nb" };
+		case Intrinsic_Kind::Less_Eq:    return Condition_Code { "be", "a"  };
+		case Intrinsic_Kind::Greater:    return Condition_Code { "a",  "be" };
+		case Intrinsic_Kind::Greater_Eq: return Condition_Code { "nb", "b"  };
+		default:
+			return std::nullopt;
+		}
+	}
+
+	// Destination of conditional jump emitted for `if` or `do`. Usually jump is taken when condition
+	// is false and leaves the block, in condition repeated at the end of rotated loop it is taken
+	// when condition is true and goes back to loop body.
+	struct Branch_Target
+	{
+		std::string label;
+		bool when_true = false;
+	};
+
+	auto default_branch_target(Operation const& branch, std::string_view instr_prefix) -> Branch_Target
+	{
+		assert(branch.jump != Operation::Empty_Jump);
+		return { std::format("{}{}", instr_prefix, branch.jump) };
+	}
+
+	// Fuses condition computation with following `if` or `do`, so instead of materializing
+	// boolean on the stack and testing it, flags are used directly by conditional jump.
+	// Supported shapes (with any number of `!` before branch, except after `and` / `or` with comparison):
+	//   <compare> if,  ! if,  and if,  or if,  <compare> and if,  <compare> or if
+	// Since branch only tests for non-zero, `bit-and` and `bit-or` are treated as `and` and `or`.
+	// Returns number of consumed operations, 0 when sequence does not match.
+	auto emit_condition_branch(Generation_Info const& geninfo, std::vector<Operation> const& ops, unsigned i, std::ostream& asm_file, std::string_view instr_prefix, std::string_view name, std::optional<Branch_Target> const& rotated = std::nullopt) -> unsigned
+	{
+		auto const is_intrinsic = [&](unsigned j, Intrinsic_Kind kind) {
+			return j < ops.size() && ops[j].kind == Operation::Kind::Intrinsic && ops[j].intrinsic == kind;
+		};
+
+		auto const is_and = [&](unsigned j) {
+			return is_intrinsic(j, Intrinsic_Kind::Boolean_And) || is_intrinsic(j, Intrinsic_Kind::Bitwise_And);
+		};
+		auto const is_or = [&](unsigned j) {
+			return is_intrinsic(j, Intrinsic_Kind::Boolean_Or) || is_intrinsic(j, Intrinsic_Kind::Bitwise_Or);
+		};
+
+		if (ops[i].kind != Operation::Kind::Intrinsic)
+			return 0;
+
+		auto const compare = condition_code(ops[i].intrinsic);
+		auto j = i + (compare.has_value() || is_and(i) || is_or(i));
+
+		// `and` or `or` directly after comparison consume another value
+		std::optional<Intrinsic_Kind> combined_with = std::nullopt;
+		if (compare && (is_and(j) || is_or(j)))
+			combined_with = is_and(j++) ? Intrinsic_Kind::Boolean_And : Intrinsic_Kind::Boolean_Or;
+
+		bool negated = false;
+		for (; is_intrinsic(j, Intrinsic_Kind::Boolean_Negate); ++j) {
+			if (combined_with)
+				return 0;
+			negated = !negated;
+		}
+
+		if (j == i || j >= ops.size() || (ops[j].kind != Operation::Kind::If && ops[j].kind != Operation::Kind::Do))
+			return 0;
+
+		if (has_jump_target_inside(geninfo, name, i, j))
+			return 0;
+
+		auto const target = rotated ? *rotated : default_branch_target(ops[j], instr_prefix);
+
+		asm_file << "	;; fused condition |";
+		for (auto k = i; k < j; ++k)
+			asm_file << ' ' << ops[k].token.sval;
+		asm_file << " | if | do\n";
+
+		if (compare) {
+			asm_file << "	pop rbx\n";
+			asm_file << "	pop rax\n";
+			if (combined_with == Intrinsic_Kind::Boolean_And) {
+				// comparison result is 0 or 1, so only lowest bit of second operand matters
+				asm_file << "	pop rcx\n";
+				asm_file << "	test rcx, 1\n";
+				if (target.when_true) {
+					asm_file << "	jz " << instr_prefix << j << "_skip\n";
+					asm_file << "	cmp rax, rbx\n";
+					asm_file << "	j" << compare->when_true << ' ' << target.label << '\n';
+					asm_file << instr_prefix << j << "_skip:\n";
+					return j - i + 1;
+				}
+				asm_file << "	jz " << target.label << '\n';
+			} else if (combined_with == Intrinsic_Kind::Boolean_Or) {
+				asm_file << "	pop rcx\n";
+				asm_file << "	cmp rax, rbx\n";
+				if (target.when_true) {
+					asm_file << "	j" << compare->when_true << ' ' << target.label << '\n';
+					asm_file << "	test rcx, rcx\n";
+					asm_file << "	jnz " << target.label << '\n';
+					return j - i + 1;
+				}
+				asm_file << "	j" << compare->when_true << ' ' << instr_prefix << j << "_then\n";
+				asm_file << "	test rcx, rcx\n";
+				asm_file << "	jz " << target.label << '\n';
+				asm_file << instr_prefix << j << "_then:\n";
+				return j - i + 1;
+			}
+			asm_file << "	cmp rax, rbx\n";
+			asm_file << "	j" << (negated != target.when_true ? compare->when_true : compare->when_false) << ' ' << target.label << '\n';
+			return j - i + 1;
+		}
+
+		switch (auto const& first = ops[i]; first.intrinsic) {
+		case Intrinsic_Kind::Boolean_And:
+		case Intrinsic_Kind::Bitwise_And:
+			asm_file << "	pop rbx\n";
+			asm_file << "	pop rax\n";
+			asm_file << "	test rax, rbx\n";
+			break;
+		case Intrinsic_Kind::Boolean_Or:
+		case Intrinsic_Kind::Bitwise_Or:
+			asm_file << "	pop rbx\n";
+			asm_file << "	pop rax\n";
+			asm_file << "	or rax, rbx\n";
+			break;
+		default:
+			assert(first.intrinsic == Intrinsic_Kind::Boolean_Negate);
+			asm_file << "	pop rax\n";
+			asm_file << "	test rax, rax\n";
+			break;
+		}
+		asm_file << "	j" << (negated != target.when_true ? "nz " : "z ") << target.label << '\n';
+		return j - i + 1;
+	}
+
+	struct Division_Magic
+	{
+		std::uint64_t multiplier;
+		unsigned shift;
+		bool needs_add; // multiplier has implicit 65th bit
+	};
+
+	// Finds multiplier and shift such that a / divisor == (a * multiplier) >> (64 + shift)
+	// for every 64 bit unsigned a (Granlund-Montgomery). Divisor must not be power of two.
+	auto unsigned_division_magic(std::uint64_t divisor) -> Division_Magic
+	{
+		using u128 = unsigned __int128;
+		assert(divisor > 2 && !std::has_single_bit(divisor));
+
+		for (unsigned shift = 0; shift < 64; ++shift) {
+			u128 const power = u128(1) << (64 + shift);
+			u128 const multiplier = power / divisor + 1;
+			if (multiplier >> 64)
 				break;
-			case Operation::Kind::Else:
-				assert(op.jump != Operation::Empty_Jump);
-				asm_file << "	;; else\n";
-				asm_file << "	jmp " << instr_prefix << op.jump << '\n';
+			if (multiplier * divisor - power <= (u128(1) << shift))
+				return { std::uint64_t(multiplier), shift, false };
+		}
+
+		auto const log = unsigned(std::bit_width(divisor - 1));
+		auto const multiplier = (u128(1) << 64) * ((u128(1) << log) - divisor) / divisor + 1;
+		return { std::uint64_t(multiplier), log, true };
+	}
+
+	// Checks if value can be encoded as sign extended 32 bit immediate
+	auto fits_imm32(std::uint64_t value) -> bool
+	{
+		return std::int64_t(value) >= std::numeric_limits<std::int32_t>::min()
+			&& std::int64_t(value) <= std::numeric_limits<std::int32_t>::max();
+	}
+
+	// Computes rax = rcx / divisor, clobbering rdx
+	auto emit_unsigned_division(std::ostream& asm_file, std::uint64_t divisor)
+	{
+		asm_file << "	mov rax, rcx\n";
+		if (std::has_single_bit(divisor)) {
+			if (divisor > 1)
+				asm_file << "	shr rax, " << std::countr_zero(divisor) << '\n';
+			return;
+		}
+
+		auto const magic = unsigned_division_magic(divisor);
+		asm_file << "	mov rdx, " << magic.multiplier << '\n';
+		asm_file << "	mul rdx\n";
+		if (magic.needs_add) {
+			asm_file << "	mov rax, rcx\n";
+			asm_file << "	sub rax, rdx\n";
+			asm_file << "	shr rax, 1\n";
+			asm_file << "	add rax, rdx\n";
+			if (magic.shift > 1)
+				asm_file << "	shr rax, " << magic.shift - 1 << '\n';
+		} else {
+			asm_file << "	mov rax, rdx\n";
+			if (magic.shift > 0)
+				asm_file << "	shr rax, " << magic.shift << '\n';
+		}
+	}
+
+	// Replaces multiplication and unsigned division by constant with shifts, masks, `lea`
+	// and multiplication by magic number, instead of `imul` and `div` of two stack values.
+	// Returns number of consumed operations, 0 when sequence does not match.
+	auto emit_strength_reduced(Generation_Info const& geninfo, std::vector<Operation> const& ops, unsigned i, std::ostream& asm_file, std::string_view name) -> unsigned
+	{
+		if (i + 1 >= ops.size() || ops[i].kind != Operation::Kind::Push_Int || ops[i+1].kind != Operation::Kind::Intrinsic)
+			return 0;
+
+		auto const value = ops[i].ival;
+		auto const& op = ops[i+1];
+
+		switch (op.intrinsic) {
+		case Intrinsic_Kind::Mul:
+		case Intrinsic_Kind::Div:
+		case Intrinsic_Kind::Div_Mod:
+		case Intrinsic_Kind::Mod:
+			break;
+		default:
+			return 0;
+		}
+
+		// Division by zero should trap at runtime like before
+		if (op.intrinsic != Intrinsic_Kind::Mul && value == 0)
+			return 0;
+
+		if (has_jump_target_inside(geninfo, name, i, i + 1))
+			return 0;
+
+		asm_file << "	;; " << op.token.sval << " by constant " << value << '\n';
+
+		if (op.intrinsic == Intrinsic_Kind::Mul) {
+			auto const shift = std::countr_zero(value);
+			auto const odd = value >> (shift % 64);
+			if (value == 0) {
+				asm_file << "	mov qword [rsp], 0\n";
+			} else if (odd == 1) {
+				if (shift > 0)
+					asm_file << "	shl qword [rsp], " << shift << '\n';
+			} else if (odd == 3 || odd == 5 || odd == 9) {
+				asm_file << "	mov rax, [rsp]\n";
+				asm_file << "	lea rax, [rax+rax*" << odd - 1 << "]\n";
+				if (shift > 0)
+					asm_file << "	shl rax, " << shift << '\n';
+				asm_file << "	mov [rsp], rax\n";
+			} else if (fits_imm32(value)) {
+				asm_file << "	imul rax, [rsp], " << std::int64_t(value) << '\n';
+				asm_file << "	mov [rsp], rax\n";
+			} else {
+				asm_file << "	mov rax, " << value << '\n';
+				asm_file << "	imul rax, [rsp]\n";
+				asm_file << "	mov [rsp], rax\n";
+			}
+			return 2;
+		}
+
+		if (std::has_single_bit(value) && op.intrinsic != Intrinsic_Kind::Div_Mod) {
+			if (op.intrinsic == Intrinsic_Kind::Div) {
+				if (value > 1)
+					asm_file << "	shr qword [rsp], " << std::countr_zero(value) << '\n';
+			} else if (fits_imm32(value - 1)) {
+				asm_file << "	and qword [rsp], " << value - 1 << '\n';
+			} else {
+				asm_file << "	mov rax, " << value - 1 << '\n';
+				asm_file << "	and [rsp], rax\n";
+			}
+			return 2;
+		}
+
+		asm_file << "	pop rcx\n";
+		emit_unsigned_division(asm_file, value);
+		if (op.intrinsic != Intrinsic_Kind::Div) {
+			// remainder = dividend - quotient * divisor
+			if (fits_imm32(value)) {
+				asm_file << "	imul rbx, rax, " << std::int64_t(value) << '\n';
+			} else {
+				asm_file << "	mov rbx, " << value << '\n';
+				asm_file << "	imul rbx, rax\n";
+			}
+			asm_file << "	sub rcx, rbx\n";
+			asm_file << "	push rcx\n";
+		}
+		if (op.intrinsic != Intrinsic_Kind::Mod)
+			asm_file << "	push rax\n";
+		return 2;
+	}
+
+	// Uses immediate forms of instructions when intrinsic's operand is an integer, operating directly
+	// on the top of the stack instead of pushing constant and popping it back:
+	//   C +|-|bit-and|bit-or|bit-xor|<<|>>,  C <compare>,  C <compare> if|do
+	// Returns number of consumed operations, 0 when sequence does not match.
+	auto emit_immediate_operand(Generation_Info const& geninfo, std::vector<Operation> const& ops, unsigned i, std::ostream& asm_file, std::string_view instr_prefix, std::string_view name, std::optional<Branch_Target> const& rotated = std::nullopt) -> unsigned
+	{
+		if (i + 1 >= ops.size() || ops[i].kind != Operation::Kind::Push_Int || ops[i+1].kind != Operation::Kind::Intrinsic)
+			return 0;
+
+		auto const value = ops[i].ival;
+		auto const& op = ops[i+1];
+
+		char const* instruction = nullptr;
+		switch (op.intrinsic) {
+		case Intrinsic_Kind::Add:         instruction = "add"; break;
+		case Intrinsic_Kind::Subtract:    instruction = "sub"; break;
+		case Intrinsic_Kind::Bitwise_And: instruction = "and"; break;
+		case Intrinsic_Kind::Bitwise_Or:  instruction = "or";  break;
+		case Intrinsic_Kind::Bitwise_Xor: instruction = "xor"; break;
+		case Intrinsic_Kind::Left_Shift:  instruction = "sal"; break;
+		case Intrinsic_Kind::Right_Shift: instruction = "sar"; break;
+		default:
+			if (!condition_code(op.intrinsic))
+				return 0;
+		}
+
+		auto const is_shift = op.intrinsic == Intrinsic_Kind::Left_Shift || op.intrinsic == Intrinsic_Kind::Right_Shift;
+		if (!is_shift && !fits_imm32(value))
+			return 0;
+
+		auto const branches = i + 2 < ops.size() && (ops[i+2].kind == Operation::Kind::If || ops[i+2].kind == Operation::Kind::Do);
+		auto const consumed = instruction || !branches ? 2u : 3u;
+		if (has_jump_target_inside(geninfo, name, i, i + consumed - 1))
+			return 0;
+
+		asm_file << "	;; " << op.token.sval << " with immediate " << value << '\n';
+
+		if (instruction) {
+			asm_file << '\t' << instruction << " qword [rsp], " << (is_shift ? std::int64_t(value & 63) : std::int64_t(value)) << '\n';
+			return consumed;
+		}
+
+		auto const code = *condition_code(op.intrinsic);
+		if (consumed == 3) {
+			asm_file << "	pop rax\n";
+			asm_file << "	cmp rax, " << std::int64_t(value) << '\n';
+			auto const target = rotated ? *rotated : default_branch_target(ops[i+2], instr_prefix);
+			asm_file << "	j" << (target.when_true ? code.when_true : code.when_false) << ' ' << target.label << '\n';
+			return consumed;
+		}
+
+		asm_file << "	xor eax, eax\n";
+		asm_file << "	cmp qword [rsp], " << std::int64_t(value) << '\n';
+		asm_file << "	set" << code.when_true << " al\n";
+		asm_file << "	mov [rsp], rax\n";
+		return consumed;
+	}
+
+	struct Fused_Address
+	{
+		unsigned length; // number of operations computing address
+		unsigned inputs; // values taken from the stack, top one into rax, second into rcx
+		std::string operand;
+	};
+
+	// Finds address computations starting at index `i` that can be expressed as x86 memory operand
+	// `[base + index*scale + displacement]`, longest first:
+	//   S * Sym D + +,  S * Sym +,  Sym D + +,  Sym D +,  Sym +,  Sym,  D +,  +
+	// where Sym is symbol, S is scale (1, 2, 4 or 8) and D is integer displacement.
+	auto match_addresses(std::vector<Operation> const& ops, unsigned i) -> std::vector<Fused_Address>
+	{
+		auto const is_int = [&](unsigned j) { return j < ops.size() && ops[j].kind == Operation::Kind::Push_Int; };
+		auto const is_symbol = [&](unsigned j) { return j < ops.size() && ops[j].kind == Operation::Kind::Push_Symbol; };
+		auto const is_intrinsic = [&](unsigned j, Intrinsic_Kind kind) {
+			return j < ops.size() && ops[j].kind == Operation::Kind::Intrinsic && ops[j].intrinsic == kind;
+		};
+		auto const is_add = [&](unsigned j) { return is_intrinsic(j, Intrinsic_Kind::Add); };
+
+		// Symbols are linked into lowest 2GB of address space, small displacement keeps address within 32 bits
+		auto const is_symbol_displacement = [&](unsigned j) {
+			return is_int(j) && std::int64_t(ops[j].ival) > -(1 << 24) && std::int64_t(ops[j].ival) < (1 << 24);
+		};
+		auto const displacement = [&](unsigned j) {
+			auto const value = std::int64_t(ops[j].ival);
+			return value < 0 ? std::format("-{}", -value) : std::format("+{}", value);
+		};
+		auto const symbol = [&](unsigned j) { return std::format("{}{}", ops[j].symbol_prefix, ops[j].ival); };
+
+		std::vector<Fused_Address> addresses;
+
+		if (is_int(i) && is_intrinsic(i+1, Intrinsic_Kind::Mul) && is_symbol(i+2)) {
+			auto const scale = ops[i].ival;
+			if (scale == 1 || scale == 2 || scale == 4 || scale == 8) {
+				auto const base = std::format("{}+rax*{}", symbol(i+2), scale);
+				if (is_symbol_displacement(i+3) && is_add(i+4) && is_add(i+5))
+					addresses.push_back({ 6, 1, std::format("[{}{}]", base, displacement(i+3)) });
+				if (is_add(i+3))
+					addresses.push_back({ 4, 1, std::format("[{}]", base) });
+			}
+		}
+
+		if (is_symbol(i)) {
+			if (is_symbol_displacement(i+1) && is_add(i+2)) {
+				if (is_add(i+3))
+					addresses.push_back({ 4, 1, std::format("[{}+rax{}]", symbol(i), displacement(i+1)) });
+				addresses.push_back({ 3, 0, std::format("[{}{}]", symbol(i), displacement(i+1)) });
+			}
+			if (is_add(i+1))
+				addresses.push_back({ 2, 1, std::format("[{}+rax]", symbol(i)) });
+			addresses.push_back({ 1, 0, std::format("[{}]", symbol(i)) });
+		}
+
+		if (is_int(i) && fits_imm32(ops[i].ival) && is_add(i+1))
+			addresses.push_back({ 2, 1, std::format("[rax{}]", displacement(i)) });
+
+		if (is_add(i))
+			addresses.push_back({ 1, 2, "[rcx+rax]" });
+
+		return addresses;
+	}
+
+	// Folds address arithmetic into memory operand of following load or store:
+	//   <address> loadN                 value loaded from address
+	//   <address> swap storeN           value under address stored
+	//   <address> swap C +|- storeN     same, value adjusted by constant
+	//   <address> C storeN              constant stored
+	// Returns number of consumed operations, 0 when sequence does not match.
+	auto emit_fused_memory_access(Generation_Info const& geninfo, std::vector<Operation> const& ops, unsigned i, std::ostream& asm_file, std::string_view name) -> unsigned
+	{
+		auto const is_intrinsic = [&](unsigned j, Intrinsic_Kind kind) {
+			return j < ops.size() && ops[j].kind == Operation::Kind::Intrinsic && ops[j].intrinsic == kind;
+		};
+
+		for (auto const& address : match_addresses(ops, i)) {
+			auto j = address.length + i;
+
+			enum { Load, Store, Store_Constant } kind;
+			std::optional<Operation> adjustment = std::nullopt, constant = std::nullopt;
+
+			if (is_intrinsic(j, Intrinsic_Kind::Load)) {
+				kind = Load;
+			} else if (is_intrinsic(j, Intrinsic_Kind::Swap)) {
+				kind = Store;
+				if (j + 2 < ops.size() && ops[j+1].kind == Operation::Kind::Push_Int && fits_imm32(ops[j+1].ival)
+					&& (is_intrinsic(j+2, Intrinsic_Kind::Add) || is_intrinsic(j+2, Intrinsic_Kind::Subtract))) {
+					adjustment = ops[j+2];
+					adjustment->ival = ops[j+1].ival;
+					j += 2;
+				}
+				++j;
+				if (!is_intrinsic(j, Intrinsic_Kind::Store))
+					continue;
+			} else if (j < ops.size() && ops[j].kind == Operation::Kind::Push_Int && is_intrinsic(j+1, Intrinsic_Kind::Store)) {
+				kind = Store_Constant;
+				constant = ops[j++];
+			} else {
+				continue;
+			}
+
+			auto const size = memory_access_size(ops[j]);
+			if (kind == Store_Constant && size == 3 && !fits_imm32(constant->ival))
+				continue;
+
+			if (has_jump_target_inside(geninfo, name, i, j))
+				continue;
+
+			asm_file << "	;; fused memory access |";
+			for (auto k = i; k <= j; ++k)
+				asm_file << ' ' << ops[k].token.sval;
+			asm_file << '\n';
+
+			if (address.inputs >= 1) asm_file << "	pop rax\n";
+			if (address.inputs >= 2) asm_file << "	pop rcx\n";
+
+			switch (kind) {
+			case Load:
+				emit_load(asm_file, size, address.operand);
+				asm_file << "	push rbx\n";
 				break;
-			case Operation::Kind::While:
-				asm_file << "	;; while\n";
+			case Store:
+				asm_file << "	pop rdx\n";
+				if (adjustment)
+					asm_file << '\t' << (adjustment->intrinsic == Intrinsic_Kind::Add ? "add" : "sub") << " rdx, " << std::int64_t(adjustment->ival) << '\n';
+				asm_file << "	mov " << address.operand << ", " << Register_D_By_Size[size] << '\n';
+				break;
+			case Store_Constant:
+				{
+					// Only lowest bytes of constant are stored
+					auto const value = size == 3 ? std::int64_t(constant->ival) : std::int64_t(constant->ival & ((std::uint64_t(1) << (8 << size)) - 1));
+					asm_file << "	mov " << Size_Names[size] << ' ' << address.operand << ", " << value << '\n';
+				}
 				break;
 			}
+			return j - i + 1;
 		}
+		return 0;
+	}
 
-		asm_file << instr_prefix << ops.size() << ":";
+	struct Loop_Invariant
+	{
+		unsigned first, last;
+		char const* reg;
+	};
+
+	// Stack effect (consumed, produced) of operations that are pure and cannot trap
+	auto pure_stack_effect(Operation const& op) -> std::optional<std::pair<unsigned, unsigned>>
+	{
+		switch (op.kind) {
+		case Operation::Kind::Push_Int:
+		case Operation::Kind::Push_Symbol:
+			return std::pair { 0u, 1u };
+		case Operation::Kind::Cast:
+			return std::pair { 0u, 0u };
+		case Operation::Kind::Intrinsic:
+			break;
+		default:
+			return std::nullopt;
+		}
+
+		switch (op.intrinsic) {
+		case Intrinsic_Kind::Argc:
+		case Intrinsic_Kind::Argv:
+			return std::pair { 0u, 1u };
+		case Intrinsic_Kind::Add:
+		case Intrinsic_Kind::Subtract:
+		case Intrinsic_Kind::Mul:
+		case Intrinsic_Kind::Bitwise_And:
+		case Intrinsic_Kind::Bitwise_Or:
+		case Intrinsic_Kind::Bitwise_Xor:
+		case Intrinsic_Kind::Left_Shift:
+		case Intrinsic_Kind::Right_Shift:
+		case Intrinsic_Kind::Min:
+		case Intrinsic_Kind::Max:
+			return std::pair { 2u, 1u };
+		case Intrinsic_Kind::Drop:     return std::pair { 1u, 0u };
+		case Intrinsic_Kind::Dup:      return std::pair { 1u, 2u };
+		case Intrinsic_Kind::Swap:     return std::pair { 2u, 2u };
+		case Intrinsic_Kind::Over:     return std::pair { 2u, 3u };
+		case Intrinsic_Kind::Tuck:     return std::pair { 2u, 3u };
+		case Intrinsic_Kind::Rot:      return std::pair { 3u, 3u };
+		case Intrinsic_Kind::Two_Drop: return std::pair { 2u, 0u };
+		case Intrinsic_Kind::Two_Dup:  return std::pair { 2u, 4u };
+		case Intrinsic_Kind::Two_Over: return std::pair { 4u, 6u };
+		case Intrinsic_Kind::Two_Swap: return std::pair { 4u, 4u };
+		default:
+			return std::nullopt;
+		}
 	}
 
-	void generate_assembly(Generation_Info &geninfo, fs::path const& asm_path)
+	// Finds longest sequence starting at `first` that pushes exactly one value without
+	// consuming anything that was on the stack before it. Such value depends only on symbols,
+	// constants and program arguments, so it is the same in every iteration of the loop.
+	auto closed_expression_end(std::vector<Operation> const& ops, unsigned first, unsigned end) -> std::optional<unsigned>
 	{
-		std::ofstream asm_file(asm_path, std::ios_base::out | std::ios_base::trunc);
-		if (!asm_file) {
-			error(std::format("Cannot generate ASM file {}", asm_path.c_str()));
-			return;
+		std::optional<unsigned> last = std::nullopt;
+		unsigned depth = 0, length = 0;
+		bool has_runtime_value = false;
+
+		for (auto i = first; i < end; ++i) {
+			auto const effect = pure_stack_effect(ops[i]);
+			if (!effect || depth < effect->first)
+				break;
+			depth += effect->second - effect->first;
+			length += ops[i].kind != Operation::Kind::Cast;
+			has_runtime_value |= ops[i].kind != Operation::Kind::Push_Int && effect->first == 0 && effect->second == 1;
+
+			// Sequence of only integers is handled by constant folding
+			if (depth == 1 && length > 1 && has_runtime_value)
+				last = i;
+		}
+		return last;
+	}
+
+	// Finds loop invariant expressions in call free loop starting with `while` at index `loop`
+	// and assigns them callee saved registers that are not used by generated code otherwise.
+	auto find_loop_invariants(Generation_Info const& geninfo, std::vector<Operation> const& ops, unsigned loop, std::string_view name) -> std::vector<Loop_Invariant>
+	{
+		static char const* const Registers[] = { "r12", "r13", "r14", "r15" };
+
+		auto end = loop + 1;
+		for (; end < ops.size() && (ops[end].kind != Operation::Kind::End || ops[end].jump != loop); ++end) {
+			if (ops[end].kind == Operation::Kind::Call_Symbol)
+				return {};
+			if (ops[end].kind == Operation::Kind::Intrinsic && ops[end].intrinsic == Intrinsic_Kind::Call)
+				return {};
 		}
+		assert(end < ops.size());
 
-		asm_header(asm_file, geninfo);
+		auto const same_expression = [&](Loop_Invariant const& invariant, unsigned first, unsigned last) {
+			return std::equal(std::cbegin(ops) + first, std::cbegin(ops) + last + 1,
+					std::cbegin(ops) + invariant.first, std::cbegin(ops) + invariant.last + 1,
+					[](Operation const& lhs, Operation const& rhs) {
+						if (lhs.kind != rhs.kind)
+							return false;
+						switch (lhs.kind) {
+						case Operation::Kind::Intrinsic:   return lhs.intrinsic == rhs.intrinsic;
+						case Operation::Kind::Push_Int:    return lhs.ival == rhs.ival;
+						case Operation::Kind::Push_Symbol: return lhs.ival == rhs.ival && lhs.symbol_prefix == rhs.symbol_prefix;
+						default:                           return true;
+						}
+					});
+		};
 
-		char function_label[sizeof(Function_Body_Prefix) + 20];
-		for (auto& [name, def] : geninfo.words) {
-			if (def.kind != Word::Kind::Function)
+		std::vector<Loop_Invariant> invariants;
+		unsigned registers_used = 0;
+		for (auto i = loop + 1; i < end; ++i) {
+			auto const last = closed_expression_end(ops, i, end);
+			if (!last || has_jump_target_inside(geninfo, name, i, *last))
 				continue;
 
-			asm_file << ";; fun " << name << '\n';
-			asm_file << Function_Prefix << def.id << ":\n";
-			asm_file << "	pop rax\n";
-			asm_file << "	mov rbx, [_stacky_callptr]\n";
-			asm_file << "	mov [_stacky_callstack+rbx*8], rax\n";
-			asm_file << "	add qword [_stacky_callptr], 1\n";
+			auto const same = std::find_if(std::cbegin(invariants), std::cend(invariants), [&](auto const& invariant) {
+				return same_expression(invariant, i, *last);
+			});
 
-			std::sprintf(function_label, Function_Body_Prefix "%lu_", def.id);
-			generate_instructions(geninfo, def.function_body, asm_file, function_label, name);
-			asm_file << '\n';
-			emit_return(asm_file);
+			if (same != std::cend(invariants)) {
+				invariants.push_back({ i, *last, same->reg });
+			} else if (registers_used < std::size(Registers)) {
+				invariants.push_back({ i, *last, Registers[registers_used++] });
+			} else {
+				continue;
+			}
+			i = *last;
 		}
+		return invariants;
+	}
 
-		asm_file << "global _start\n";
-		asm_file << "_start:\n";
+	auto emit_push(Operation const& op, std::ostream& asm_file)
+	{
+		switch (op.kind) {
+		case Operation::Kind::Push_Symbol:
+			asm_file << "	;; push symbol\n";
+			asm_file << "	push " << op.symbol_prefix << op.ival << '\n';
+			break;
+		case Operation::Kind::Push_Int:
+			asm_file << "	;; push int\n";
+			asm_file << "	mov rax, " << op.ival << '\n';
+			asm_file << "	push rax\n";
+			break;
+		default:
+			unreachable("Only push operations are expected");
+		}
+	}
 
-		asm_file << "  pop rax\n";
-		asm_file << "  mov [_stacky_argc], rax\n";
-		asm_file << "  mov [_stacky_argv], rsp\n";
+	// Chain of `dup K1 = if B1 else dup K2 = if B2 else ... end end` comparing the same value
+	// against integer constants, lowered to a single dispatch on that value.
+	struct Dispatch_Chain
+	{
+		struct Case
+		{
+			std::uint64_t key;
+			unsigned branch; // index of `if` whose body is executed for the key
+		};
 
+		std::vector<unsigned> links;                // indices of `dup` starting each comparison
+		std::vector<Case> cases;                    // sorted by key, first comparison wins for duplicated keys
+		unsigned otherwise = Operation::Empty_Jump; // where execution continues when nothing matches
+	};
 
-		generate_instructions(geninfo, geninfo.main, asm_file, Label_Prefix);
+	auto find_dispatch_chains(Generation_Info const& geninfo, std::vector<Operation> const& ops, std::string_view name) -> std::vector<Dispatch_Chain>
+	{
+		static constexpr unsigned Min_Cases = 4;
 
-		asm_file << R"asm(
-	;; exit syscall
-	mov rax, 60
-	mov rdi, 0
-	syscall
-)asm";
+		auto const is_link = [&](unsigned i) {
+			return i + 3 < ops.size()
+				&& ops[i].kind == Operation::Kind::Intrinsic && ops[i].intrinsic == Intrinsic_Kind::Dup
+				&& ops[i+1].kind == Operation::Kind::Push_Int
+				&& ops[i+2].kind == Operation::Kind::Intrinsic && ops[i+2].intrinsic == Intrinsic_Kind::Equal
+				&& ops[i+3].kind == Operation::Kind::If
+				&& !has_jump_target_inside(geninfo, name, i, i + 3);
+		};
+
+		std::vector<Dispatch_Chain> chains;
+		for (auto i = 0u; i < ops.size(); ++i) {
+			Dispatch_Chain chain;
+			for (auto link = i; is_link(link); ) {
+				chain.links.push_back(link);
+				auto const branch = link + 3;
+				if (std::none_of(std::cbegin(chain.cases), std::cend(chain.cases), [&](auto const& c) { return c.key == ops[link+1].ival; }))
+					chain.cases.push_back({ ops[link+1].ival, branch });
+				chain.otherwise = ops[branch].jump;
+
+				// Next comparison has to be the only content of else branch
+				if (ops[branch].jump == 0 || ops[ops[branch].jump - 1].kind != Operation::Kind::Else)
+					break;
+				link = ops[branch].jump;
+			}
+
+			if (chain.cases.size() < Min_Cases)
+				continue;
+
+			std::sort(std::begin(chain.cases), std::end(chain.cases), [](auto const& lhs, auto const& rhs) { return lhs.key < rhs.key; });
+			i = chain.links.back() + 3;
+			chains.push_back(std::move(chain));
+		}
+		return chains;
+	}
+
+	// Jumps to the body of matching case with value from the top of the stack left in place,
+	// through bounds-checked jump table when keys are dense and binary search otherwise.
+	auto emit_dispatch(Dispatch_Chain const& chain, std::ostream& asm_file, std::string_view instr_prefix)
+	{
+		static constexpr std::uint64_t Max_Table_Size = 1024;
+
+		auto const case_label = [&](Dispatch_Chain::Case const& c) { return std::format("{}{}_case", instr_prefix, c.branch); };
+		auto const otherwise = std::format("{}{}", instr_prefix, chain.otherwise);
+
+		auto const compare = [&](std::uint64_t key) {
+			if (fits_imm32(key)) {
+				asm_file << "	cmp rax, " << std::int64_t(key) << '\n';
+			} else {
+				asm_file << "	mov rcx, " << key << '\n';
+				asm_file << "	cmp rax, rcx\n";
+			}
+		};
+
+		asm_file << "	mov rax, [rsp]\n";
+
+		auto const min = chain.cases.front().key, range = chain.cases.back().key - min;
+		if (range < Max_Table_Size && range < 3 * chain.cases.size()) {
+			asm_file << "	;; dispatch through jump table\n";
+			if (min != 0) {
+				if (fits_imm32(min)) {
+					asm_file << "	sub rax, " << std::int64_t(min) << '\n';
+				} else {
+					asm_file << "	mov rcx, " << min << '\n';
+					asm_file << "	sub rax, rcx\n";
+				}
+			}
+			asm_file << "	cmp rax, " << range << '\n';
+			asm_file << "	ja " << otherwise << '\n';
+			asm_file << "	jmp [" << instr_prefix << chain.links.front() << "_table+rax*8]\n";
+			asm_file << "	align 8\n";
+			asm_file << instr_prefix << chain.links.front() << "_table:\n";
+			auto c = std::cbegin(chain.cases);
+			for (auto key = min; key - min <= range; ++key) {
+				if (c->key == key) {
+					asm_file << "	dq " << case_label(*c++) << '\n';
+				} else {
+					asm_file << "	dq " << otherwise << '\n';
+				}
+			}
+			return;
+		}
+
+		asm_file << "	;; dispatch through binary search\n";
+		std::function<void(unsigned, unsigned)> search = [&](unsigned first, unsigned last) {
+			if (last - first <= 3) {
+				for (auto c = first; c < last; ++c) {
+					compare(chain.cases[c].key);
+					asm_file << "	je " << case_label(chain.cases[c]) << '\n';
+				}
+				asm_file << "	jmp " << otherwise << '\n';
+				return;
+			}
+			auto const middle = (first + last) / 2;
+			compare(chain.cases[middle].key);
+			asm_file << "	je " << case_label(chain.cases[middle]) << '\n';
+			asm_file << "	ja " << case_label(chain.cases[middle]) << "_above\n";
+			search(first, middle);
+			asm_file << case_label(chain.cases[middle]) << "_above:\n";
+			search(middle + 1, last);
+		};
+		search(0, chain.cases.size());
+	}
+
+	// Loops whose condition is short and has no control flow are rotated: condition is repeated
+	// at the end of the loop and jumps back to the body when true, so every iteration takes single
+	// branch instead of `jmp` to `while` and a test. Returns index of `do` of such loop.
+	auto rotated_loop_condition(std::vector<Operation> const& ops, unsigned while_op) -> std::optional<unsigned>
+	{
+		static constexpr unsigned Max_Condition_Length = 8;
+
+		for (auto i = while_op + 1; i < ops.size() && i <= while_op + 1 + Max_Condition_Length; ++i) {
+			switch (ops[i].kind) {
+			case Operation::Kind::Intrinsic:
+			case Operation::Kind::Push_Int:
+			case Operation::Kind::Push_Symbol:
+			case Operation::Kind::Call_Symbol:
+			case Operation::Kind::Cast:
+				continue;
+			case Operation::Kind::Do:
+				return i;
+			default:
+				return std::nullopt;
+			}
+		}
+		return std::nullopt;
+	}
+
+	// Leaf functions without control flow and with known stack effect get second entry point that takes
+	// inputs and returns outputs in Call_Registers (deepest value first) and keeps all values in registers.
+	// Return address stays on the machine stack, so call stack is not touched.
+	static char const* const Call_Registers[] = { "rdi", "rsi", "rdx", "rcx", "r8", "r9" };
+
+	// Registers holding values inside register functions, by access size. Call registers come first.
+	static char const* const Value_Registers[][4] = {
+		{ "dil",  "di",   "edi",  "rdi" },
+		{ "sil",  "si",   "esi",  "rsi" },
+		{ "dl",   "dx",   "edx",  "rdx" },
+		{ "cl",   "cx",   "ecx",  "rcx" },
+		{ "r8b",  "r8w",  "r8d",  "r8"  },
+		{ "r9b",  "r9w",  "r9d",  "r9"  },
+		{ "al",   "ax",   "eax",  "rax" },
+		{ "bl",   "bx",   "ebx",  "rbx" },
+		{ "r10b", "r10w", "r10d", "r10" },
+		{ "r11b", "r11w", "r11d", "r11" },
+	};
+
+	struct Register_Function
+	{
+		unsigned inputs;
+		unsigned outputs;
+		std::string body;
+	};
+
+	using Register_Functions = std::unordered_map<std::uint64_t, Register_Function>;
+
+	// Compiles body of register function from its SSA form, nothing when function does not qualify.
+	// Registers are assigned by linear scan over instructions, value keeps its register until its last use.
+	auto compile_register_function(Generation_Info const& geninfo, Word const& word) -> std::optional<Register_Function>
+	{
+		auto const inputs = unsigned(word.effect.input.size()), outputs = unsigned(word.effect.output.size());
+		if (!word.has_effect || word.is_dynamically_typed || inputs > std::size(Call_Registers) || outputs > std::size(Call_Registers))
+			return std::nullopt;
+
+		auto const function = ssa::translate(geninfo, word.function_body);
+		if (!function || function->parameters > inputs || inputs - function->parameters + function->outputs.size() != outputs)
+			return std::nullopt;
+
+		// Instructions in order of execution, body without branches is chain of blocks
+		std::vector<ssa::Value> order;
+		for (auto b = 0u;; b = function->blocks[b].next) {
+			auto const& block = function->blocks[b];
+			if (block.terminator == ssa::Block::Terminator::Branch)
+				return std::nullopt;
+			order.insert(std::end(order), std::cbegin(block.instructions), std::cend(block.instructions));
+			if (block.terminator == ssa::Block::Terminator::Exit)
+				break;
+		}
+
+		// Value lives in register or is an immediate known at assembly time
+		struct Place
+		{
+			std::optional<unsigned> reg = std::nullopt;
+			std::optional<std::uint64_t> constant = std::nullopt;
+			std::string symbol = {};
+		};
+
+		auto const& values = function->values;
+		std::vector<Place> places(values.size());
+
+		// Position in order of last instruction reading the value (or its definition when it is not read),
+		// outputs are read after all instructions
+		std::vector<unsigned> last_use(values.size());
+		for (auto k = 0u; k < order.size(); ++k) {
+			last_use[order[k]] = k;
+			for (auto const input : values[order[k]].inputs)
+				last_use[input] = k;
+		}
+		for (auto const output : function->outputs)
+			last_use[output] = order.size();
+
+		// Inputs below the ones that body reads stay in their registers until the end
+		auto const untouched = inputs - function->parameters;
+		std::vector<std::optional<ssa::Value>> held(std::size(Value_Registers));
+
+		std::ostringstream out;
+
+		auto const full = [](unsigned reg) { return Value_Registers[reg][3]; };
+		auto const low = [](unsigned reg) { return Value_Registers[reg][0]; };
+		auto const operand = [&](Place const& p) -> std::string {
+			return p.reg ? full(*p.reg) : p.constant ? std::to_string(*p.constant) : p.symbol;
+		};
+
+		auto const assign = [&](ssa::Value v, unsigned reg) {
+			held[reg] = v;
+			places[v] = { .reg = reg };
+		};
+
+		// Register not holding any value read by instruction at position `k` or later
+		auto const free_register = [&](unsigned k) -> std::optional<unsigned> {
+			for (auto reg = untouched; reg < std::size(Value_Registers); ++reg)
+				if (!held[reg] || last_use[*held[reg]] < k)
+					return reg;
+			return std::nullopt;
+		};
+
+		auto const move_to_free_register = [&](ssa::Value v, unsigned k) {
+			auto const reg = free_register(k);
+			if (!reg)
+				return false;
+			out << "	mov " << full(*reg) << ", " << operand(places[v]) << '\n';
+			assign(v, *reg);
+			return true;
+		};
+
+		// Register for result of instruction at `k` computed from `a`, which is register of `a` when this is its last use
+		auto const result_register = [&](ssa::Value result, ssa::Value a, unsigned k) -> std::optional<unsigned> {
+			if (places[a].reg && last_use[a] == k) {
+				assign(result, *places[a].reg);
+				return places[a].reg;
+			}
+			auto const reg = free_register(k);
+			if (!reg)
+				return std::nullopt;
+			out << "	mov " << full(*reg) << ", " << operand(places[a]) << '\n';
+			assign(result, *reg);
+			return reg;
+		};
+
+		for (auto k = 0u; k < order.size(); ++k) {
+			auto const v = order[k];
+			auto const& instruction = values[v];
+			switch (instruction.kind) {
+			case ssa::Instruction::Kind::Parameter:
+				assign(v, untouched + unsigned(instruction.ival));
+				continue;
+			case ssa::Instruction::Kind::Constant:
+				places[v] = { .constant = instruction.ival };
+				continue;
+			case ssa::Instruction::Kind::Symbol:
+				places[v] = { .symbol = std::format("{}{}", instruction.symbol_prefix, instruction.ival) };
+				continue;
+			case ssa::Instruction::Kind::Intrinsic:
+				break;
+			default:
+				return std::nullopt;
+			}
+
+			auto const& op = word.function_body[instruction.op];
+			switch (op.intrinsic) {
+			case Intrinsic_Kind::Argc:
+			case Intrinsic_Kind::Argv:
+				places[v] = { .symbol = op.intrinsic == Intrinsic_Kind::Argc ? "[_stacky_argc]" : "[_stacky_argv]" };
+				if (!move_to_free_register(v, k))
+					return std::nullopt;
+				continue;
+			case Intrinsic_Kind::Boolean_Negate:
+				if (auto const reg = result_register(v, instruction.inputs[0], k)) {
+					out << "	test " << full(*reg) << ", " << full(*reg) << '\n';
+					out << "	sete " << low(*reg) << '\n';
+					out << "	movzx " << full(*reg) << ", " << low(*reg) << '\n';
+					continue;
+				}
+				return std::nullopt;
+			case Intrinsic_Kind::Load:
+				if (auto const reg = result_register(v, instruction.inputs[0], k)) {
+					switch (auto const size = memory_access_size(op)) {
+					case 0:
+					case 1: out << "	movzx " << full(*reg) << ", " << Size_Names[size] << " [" << full(*reg) << "]\n"; break;
+					case 2: out << "	mov " << Value_Registers[*reg][2] << ", [" << full(*reg) << "]\n"; break;
+					default: out << "	mov " << full(*reg) << ", [" << full(*reg) << "]\n"; break;
+					}
+					continue;
+				}
+				return std::nullopt;
+			case Intrinsic_Kind::Store:
+				{
+					auto const size = memory_access_size(op);
+					auto const& a = places[instruction.inputs[0]];
+					auto const b = instruction.inputs[1];
+					if (!(a.reg || a.symbol.size() || (a.constant && fits_imm32(*a.constant))) || !(places[b].reg || move_to_free_register(b, k)))
+						return std::nullopt;
+					out << "	mov " << Size_Names[size] << " [" << operand(a) << "], " << Value_Registers[*places[b].reg][size] << '\n';
+				}
+				continue;
+			default:
+				break;
+			}
+
+			// Remaining intrinsics take two values, computing result in place of the first one
+			if (instruction.inputs.size() != 2)
+				return std::nullopt;
+			auto const a = instruction.inputs[0], b = instruction.inputs[1];
+
+			char const* instruction_name = nullptr;
+			switch (op.intrinsic) {
+			case Intrinsic_Kind::Add:         instruction_name = "add";  break;
+			case Intrinsic_Kind::Subtract:    instruction_name = "sub";  break;
+			case Intrinsic_Kind::Mul:         instruction_name = "imul"; break;
+			case Intrinsic_Kind::Bitwise_And: instruction_name = "and";  break;
+			case Intrinsic_Kind::Bitwise_Or:  instruction_name = "or";   break;
+			case Intrinsic_Kind::Bitwise_Xor: instruction_name = "xor";  break;
+			case Intrinsic_Kind::Boolean_And: instruction_name = "and";  break;
+			case Intrinsic_Kind::Boolean_Or:  instruction_name = "or";   break;
+			case Intrinsic_Kind::Min:
+			case Intrinsic_Kind::Max:
+				instruction_name = "cmp";
+				break;
+			case Intrinsic_Kind::Left_Shift:
+			case Intrinsic_Kind::Right_Shift:
+				// Shift by register would need rcx, which may hold an argument
+				if (!places[b].constant)
+					return std::nullopt;
+				instruction_name = op.intrinsic == Intrinsic_Kind::Left_Shift ? "sal" : "sar";
+				break;
+			default:
+				if (!condition_code(op.intrinsic))
+					return std::nullopt;
+				instruction_name = "cmp";
+			}
+
+			// Ensures that `b` can be used as source operand of the instruction
+			auto const needs_register = op.intrinsic == Intrinsic_Kind::Min || op.intrinsic == Intrinsic_Kind::Max;
+			auto const& source = places[b];
+			if (!source.reg && (needs_register || (source.constant && !fits_imm32(*source.constant))) && !move_to_free_register(b, k))
+				return std::nullopt;
+
+			auto const reg = result_register(v, a, k);
+			if (!reg)
+				return std::nullopt;
+
+			auto const shift = op.intrinsic == Intrinsic_Kind::Left_Shift || op.intrinsic == Intrinsic_Kind::Right_Shift;
+			auto const rhs = shift ? std::to_string(*places[b].constant & 63) : operand(places[b]);
+			out << "	" << instruction_name << ' ' << full(*reg) << ", " << rhs << '\n';
+			switch (op.intrinsic) {
+			case Intrinsic_Kind::Min: out << "	cmova " << full(*reg) << ", " << rhs << '\n'; break;
+			case Intrinsic_Kind::Max: out << "	cmovb " << full(*reg) << ", " << rhs << '\n'; break;
+			case Intrinsic_Kind::Boolean_And:
+			case Intrinsic_Kind::Boolean_Or:
+				out << "	setne " << low(*reg) << '\n';
+				out << "	movzx " << full(*reg) << ", " << low(*reg) << '\n';
+				break;
+			default:
+				if (auto const compare = condition_code(op.intrinsic)) {
+					out << "	set" << compare->when_true << ' ' << low(*reg) << '\n';
+					out << "	movzx " << full(*reg) << ", " << low(*reg) << '\n';
+				}
+			}
+		}
+
+		std::vector<Place> stack;
+		for (auto i = 0u; i < untouched; ++i)
+			stack.push_back({ .reg = i });
+		for (auto const output : function->outputs)
+			stack.push_back(places[output]);
+
+		// Moves outputs into call registers. Move into register is done when no other pending move
+		// reads it, cycles are broken with exchange. Immediates go last, since they do not read anything.
+		auto const pending = [&](unsigned i) { return stack[i].reg && *stack[i].reg != i; };
+		for (;;) {
+			std::optional<unsigned> blocked = std::nullopt;
+			bool moved = false;
+			for (auto i = 0u; i < outputs; ++i) {
+				if (!pending(i))
+					continue;
+				auto const read = std::any_of(std::cbegin(stack), std::cend(stack), [&](Place const& v) { return &v != &stack[i] && v.reg == i && pending(&v - stack.data()); });
+				if (read) {
+					blocked = i;
+					continue;
+				}
+				out << "	mov " << full(i) << ", " << full(*stack[i].reg) << '\n';
+				stack[i].reg = i;
+				moved = true;
+			}
+			if (moved)
+				continue;
+			if (!blocked)
+				break;
+
+			auto const i = *blocked, other = *stack[i].reg;
+			out << "	xchg " << full(i) << ", " << full(other) << '\n';
+			for (auto &v : stack) {
+				if (v.reg == i) v.reg = other;
+				else if (v.reg == other) v.reg = i;
+			}
+		}
+
+		for (auto i = 0u; i < outputs; ++i)
+			if (!stack[i].reg)
+				out << "	mov " << full(i) << ", " << operand(stack[i]) << '\n';
+
+		out << "	ret\n";
+		return Register_Function { inputs, outputs, std::move(out).str() };
+	}
+
+	// Checks if syscall or call at `i` ends the program: `exit` or `exit_group` syscall, or call of
+	// function from `exiting` set
+	auto is_program_exit(std::vector<Operation> const& ops, unsigned i, std::unordered_set<std::uint64_t> const& exiting) -> bool
+	{
+		auto const& op = ops[i];
+		if (op.kind == Operation::Kind::Call_Symbol)
+			return exiting.contains(op.ival);
+		return op.kind == Operation::Kind::Intrinsic && op.intrinsic == Intrinsic_Kind::Syscall && i > 0
+			&& ops[i-1].kind == Operation::Kind::Push_Int && (ops[i-1].ival == 60 || ops[i-1].ival == 231);
+	}
+
+	// Checks if every execution of operations [first, last) ends the program, because exit happens
+	// outside of any nested branch or loop and there is no `return` that could skip it
+	auto ends_program(std::vector<Operation> const& ops, unsigned first, unsigned last, std::unordered_set<std::uint64_t> const& exiting) -> bool
+	{
+		unsigned depth = 0;
+		for (auto i = first; i < last; ++i) {
+			switch (ops[i].kind) {
+			case Operation::Kind::Return: return false;
+			case Operation::Kind::If:
+			case Operation::Kind::While:  ++depth; break;
+			case Operation::Kind::End:    --depth; break;
+			default:
+				if (depth == 0 && is_program_exit(ops, i, exiting))
+					return true;
+			}
+		}
+		return false;
+	}
+
+	// Functions that never return, computed until nothing changes since they may call each other
+	auto find_exiting_functions(Generation_Info const& geninfo) -> std::unordered_set<std::uint64_t>
+	{
+		std::unordered_set<std::uint64_t> exiting;
+		for (bool changed = true; changed;) {
+			changed = false;
+			for (auto const& [name, word] : geninfo.words) {
+				if (word.kind == Word::Kind::Function && !exiting.contains(word.id) && ends_program(word.function_body, 0, word.function_body.size(), exiting)) {
+					exiting.insert(word.id);
+					changed = true;
+				}
+			}
+		}
+		return exiting;
+	}
+
+	// Rarely executed branch of `if` is moved out of the hot path into separate section. Without profile
+	// those are bodies of `if` without `else` that end the program, like error handling after failed syscall.
+	// With profile, branch executed at most 1/Cold_Ratio times as often as the other path.
+	// Maps `if` to the first operation of its cold branch.
+	auto find_cold_branches(Profile const& profile, std::vector<Operation> const& ops, std::unordered_set<std::uint64_t> const& exiting) -> std::unordered_map<unsigned, unsigned>
+	{
+		static constexpr std::uint64_t Cold_Ratio = 16;
+
+		auto const rare = [](std::optional<std::uint64_t> branch, std::optional<std::uint64_t> other) {
+			return branch && other && *other > 0 && *branch * Cold_Ratio <= *other;
+		};
+
+		std::unordered_map<unsigned, unsigned> cold;
+		for (auto i = 0u; i < ops.size(); ++i) {
+			auto const& op = ops[i];
+			if (op.kind != Operation::Kind::If)
+				continue;
+
+			auto const then_count = profile.count(op.location, Profile_Counter::Then);
+			if (ops[op.jump - 1].kind == Operation::Kind::Else) {
+				auto const else_count = profile.count(op.location, Profile_Counter::Else);
+				if (rare(then_count, else_count))
+					cold[i] = i + 1;
+				else if (rare(else_count, then_count))
+					cold[i] = op.jump;
+			} else if (then_count ? rare(then_count, profile.count(op.location, Profile_Counter::Join)) : ends_program(ops, i + 1, op.jump, exiting)) {
+				cold[i] = i + 1;
+			}
+		}
+		return cold;
+	}
+
+	// Orders functions so that callers are placed next to their most frequent callees (Pettis-Hansen).
+	// Call frequency comes from profile or is estimated statically, each enclosing loop multiplies weight of a call by 8.
+	// Chains of functions are merged along heaviest edges first; ties are broken by word ids,
+	// so order does not depend on iteration order of words.
+	auto function_layout(Generation_Info const& geninfo) -> std::vector<Words::value_type const*>
+	{
+		static constexpr unsigned Max_Loop_Depth = 6;
+
+		std::vector<Words::value_type const*> functions;
+		for (auto const& entry : geninfo.words)
+			if (entry.second.kind == Word::Kind::Function)
+				functions.push_back(&entry);
+		std::sort(std::begin(functions), std::end(functions), [](auto lhs, auto rhs) { return lhs->second.id < rhs->second.id; });
+
+		std::map<std::pair<std::uint64_t, std::uint64_t>, std::uint64_t> weights;
+		for (auto const* entry : functions) {
+			auto const& function = entry->second;
+			auto const& body = function.function_body;
+			unsigned depth = 0;
+			for (auto i = 0u; i < body.size(); ++i) {
+				auto const& op = body[i];
+				if (op.kind == Operation::Kind::While)
+					++depth;
+				else if (op.kind == Operation::Kind::End && op.jump < i && body[op.jump].kind == Operation::Kind::While)
+					--depth;
+				else if (op.kind == Operation::Kind::Call_Symbol && op.ival != function.id)
+					weights[std::minmax(function.id, op.ival)] += geninfo.profile.count(op.location, Profile_Counter::Call)
+						.value_or(std::uint64_t(1) << (3 * std::min(depth, Max_Loop_Depth)));
+			}
+		}
+
+		std::vector<std::pair<std::uint64_t, std::pair<std::uint64_t, std::uint64_t>>> edges;
+		for (auto const& [ends, weight] : weights)
+			edges.push_back({ weight, ends });
+		std::stable_sort(std::begin(edges), std::end(edges), [](auto const& lhs, auto const& rhs) { return lhs.first > rhs.first; });
+
+		// Each function starts in its own chain, chain is identified by its first function
+		std::map<std::uint64_t, std::vector<Words::value_type const*>> chains;
+		std::unordered_map<std::uint64_t, std::uint64_t> chain_of;
+		std::unordered_map<std::uint64_t, std::uint64_t> chain_weight;
+		for (auto const* function : functions) {
+			chains[function->second.id] = { function };
+			chain_of[function->second.id] = function->second.id;
+		}
+
+		for (auto const& [weight, ends] : edges) {
+			if (!chain_of.contains(ends.first) || !chain_of.contains(ends.second))
+				continue;
+			auto const first = chain_of[ends.first], second = chain_of[ends.second];
+			if (first == second)
+				continue;
+
+			auto &merged = chains[first];
+			for (auto const* function : chains[second]) {
+				merged.push_back(function);
+				chain_of[function->second.id] = first;
+			}
+			chain_weight[first] += chain_weight[second] + weight;
+			chains.erase(second);
+			chain_weight.erase(second);
+		}
+
+		std::vector<std::pair<std::uint64_t, std::vector<Words::value_type const*> const*>> ordered;
+		for (auto const& [id, chain] : chains)
+			ordered.push_back({ chain_weight[id], &chain });
+		std::stable_sort(std::begin(ordered), std::end(ordered), [](auto const& lhs, auto const& rhs) { return lhs.first > rhs.first; });
+
+		std::vector<Words::value_type const*> layout;
+		for (auto const& [weight, chain] : ordered)
+			layout.insert(std::end(layout), std::cbegin(*chain), std::cend(*chain));
+		return layout;
+	}
+
+	// Whole program information shared by code generation of all functions
+	struct Program_Context
+	{
+		Register_Functions register_functions;
+		std::unordered_set<std::uint64_t> exiting_functions;
+		std::ostringstream cold_code; // rarely executed branches, emitted after all other code
+		std::vector<std::uint64_t> profile_keys; // keys of counters of instrumented executable
+		std::vector<std::pair<std::uint64_t, std::string_view>> call_targets; // address taken functions counted at `call`
+		std::set<Intrinsic_Kind> memory_routines; // bulk memory intrinsics whose subroutines are called
+	};
+
+	// Bulk memory intrinsics of constant size up to Max_Inline_Size bytes are done with moves of largest blocks
+	// that fit, last block overlapping previous one. All blocks are loaded before any is stored, so that
+	// `memmove` is handled too. Other sizes are passed in rdi, rsi (or al) and rcx to shared subroutines,
+	// except `memcpy` and `memset` of at least Min_String_Size bytes, which are done with `rep movsb` and `rep stosb`.
+	// Returns number of consumed operations, 0 when operation is not bulk memory intrinsic.
+	auto emit_bulk_memory(Generation_Info const& geninfo, std::vector<Operation> const& ops, unsigned i, std::ostream& asm_file, Program_Context &program, std::string_view name) -> unsigned
+	{
+		static constexpr std::uint64_t Max_Inline_Size = 64;
+		static constexpr std::uint64_t Min_String_Size = 2048;
+
+		auto const is_bulk_memory = [&](unsigned j) {
+			if (j >= ops.size() || ops[j].kind != Operation::Kind::Intrinsic)
+				return false;
+			switch (ops[j].intrinsic) {
+			case Intrinsic_Kind::Memory_Compare:
+			case Intrinsic_Kind::Memory_Copy:
+			case Intrinsic_Kind::Memory_Find:
+			case Intrinsic_Kind::Memory_Move:
+			case Intrinsic_Kind::Memory_Set:
+				return true;
+			default:
+				return false;
+			}
+		};
+
+		if (ops[i].kind == Operation::Kind::Push_Int && is_bulk_memory(i + 1) && !compiler_arguments.optimize_size
+			&& !has_jump_target_inside(geninfo, name, i, i + 1)) {
+			auto const size = ops[i].ival;
+			auto const& op = ops[i+1];
+			auto const set = op.intrinsic == Intrinsic_Kind::Memory_Set;
+
+			if (size >= Min_String_Size && (set || op.intrinsic == Intrinsic_Kind::Memory_Copy)) {
+				asm_file << "	;; " << op.token.sval << " of " << size << " bytes\n";
+				asm_file << "	mov rcx, " << size << '\n';
+				asm_file << (set ? "	pop rax\n" : "	pop rsi\n");
+				asm_file << "	pop rdi\n";
+				asm_file << (set ? "	rep stosb\n" : "	rep movsb\n");
+				return 2;
+			}
+
+			if (size > 0 && size <= Max_Inline_Size && (set || op.intrinsic == Intrinsic_Kind::Memory_Copy || op.intrinsic == Intrinsic_Kind::Memory_Move)) {
+				auto const block = std::bit_floor(std::min<std::uint64_t>(size, 16));
+				auto const log = unsigned(std::countr_zero(block));
+				std::vector<std::uint64_t> offsets;
+				for (std::uint64_t offset = 0; offset + block < size; offset += block)
+					offsets.push_back(offset);
+				offsets.push_back(size - block);
+
+				// Blocks of 16 bytes go through xmm registers, smaller ones (at most two) through rbx and rdx
+				auto const reg = [&](unsigned n) -> std::string {
+					if (block == 16)
+						return std::format("xmm{}", set ? 0 : n);
+					return n == 0 || set ? Register_B_By_Size[log] : Register_D_By_Size[log];
+				};
+				auto const move = block == 16 ? "movdqu" : "mov";
+				auto const at = [](std::string_view base, std::uint64_t offset) {
+					return offset ? std::format("[{}+{}]", base, offset) : std::format("[{}]", base);
+				};
+
+				asm_file << "	;; " << op.token.sval << " of " << size << " bytes\n";
+				if (set) {
+					asm_file << "	pop rbx\n";
+					asm_file << "	pop rdi\n";
+					asm_file << "	movzx ebx, bl\n";
+					if (block > 1) {
+						asm_file << "	mov rdx, 0x0101010101010101\n";
+						asm_file << "	imul rbx, rdx\n";
+					}
+					if (block == 16) {
+						asm_file << "	movq xmm0, rbx\n";
+						asm_file << "	punpcklqdq xmm0, xmm0\n";
+					}
+				} else {
+					asm_file << "	pop rsi\n";
+					asm_file << "	pop rdi\n";
+					for (auto n = 0u; n < offsets.size(); ++n)
+						asm_file << '\t' << move << ' ' << reg(n) << ", " << at("rsi", offsets[n]) << '\n';
+				}
+				for (auto n = 0u; n < offsets.size(); ++n)
+					asm_file << '\t' << move << ' ' << at("rdi", offsets[n]) << ", " << reg(n) << '\n';
+				return 2;
+			}
+		}
+
+		if (!is_bulk_memory(i))
+			return 0;
+
+		auto const& op = ops[i];
+		program.memory_routines.insert(op.intrinsic);
+
+		auto const with_byte = op.intrinsic == Intrinsic_Kind::Memory_Set || op.intrinsic == Intrinsic_Kind::Memory_Find;
+		asm_file << "	;; " << op.token.sval << '\n';
+		asm_file << "	pop rcx\n";
+		asm_file << (with_byte ? "	pop rax\n" : "	pop rsi\n");
+		asm_file << "	pop rdi\n";
+		asm_file << "	call _stacky_" << op.token.sval << '\n';
+		if (op.intrinsic == Intrinsic_Kind::Memory_Compare || op.intrinsic == Intrinsic_Kind::Memory_Find)
+			asm_file << "	push rax\n";
+		return 1;
+	}
+
+	// Subroutines of bulk memory intrinsics that were used. They go over blocks of 16 bytes
+	// (32 bytes with `--avx2`) while whole block fits, bytes that remain are handled by one more block
+	// ending at the last byte when there was at least one block, otherwise one at a time.
+	// Arguments are passed like to `rep` string instructions, result is returned in rax.
+	auto emit_memory_routines(Program_Context const& program, std::ostream& asm_file)
+	{
+		static constexpr unsigned Min_String_Size = 2048;
+
+		if (program.memory_routines.empty())
+			return;
+
+		auto const avx2 = compiler_arguments.avx2;
+		auto const block = avx2 ? 32 : 16;
+		auto const v = avx2 ? "v" : "";
+		auto const reg = [&](unsigned n) { return std::format("{}mm{}", avx2 ? 'y' : 'x', n); };
+		auto const ret = avx2 ? "	vzeroupper\n	ret\n" : "	ret\n";
+		auto const uses = [&](Intrinsic_Kind kind) { return program.memory_routines.contains(kind); };
+
+		// Byte in al into every byte of vector register 0
+		auto const broadcast = [&] {
+			asm_file << "	movd xmm0, eax\n";
+			if (avx2) {
+				asm_file << "	vpbroadcastb ymm0, xmm0\n";
+			} else {
+				asm_file << "	punpcklbw xmm0, xmm0\n";
+				asm_file << "	punpcklwd xmm0, xmm0\n";
+				asm_file << "	pshufd xmm0, xmm0, 0\n";
+			}
+		};
+
+		// Last block is loaded before any store, so that copy to lower address of overlapping memory is correct
+		if (uses(Intrinsic_Kind::Memory_Copy) || uses(Intrinsic_Kind::Memory_Move)) {
+			asm_file << "_stacky_memcpy:\n";
+			asm_file << "	cmp rcx, " << block << '\n';
+			asm_file << "	jb _stacky_memcpy_bytes\n";
+			asm_file << "	cmp rcx, " << Min_String_Size << '\n';
+			asm_file << "	jae _stacky_memcpy_string\n";
+			asm_file << "	lea rdx, [rcx-" << block << "]\n";
+			asm_file << '\t' << v << "movdqu " << reg(1) << ", [rsi+rdx]\n";
+			asm_file << "	xor eax, eax\n";
+			asm_file << "_stacky_memcpy_block:\n";
+			asm_file << '\t' << v << "movdqu " << reg(0) << ", [rsi+rax]\n";
+			asm_file << '\t' << v << "movdqu [rdi+rax], " << reg(0) << '\n';
+			asm_file << "	add rax, " << block << '\n';
+			asm_file << "	cmp rax, rdx\n";
+			asm_file << "	jb _stacky_memcpy_block\n";
+			asm_file << '\t' << v << "movdqu [rdi+rdx], " << reg(1) << '\n';
+			asm_file << ret;
+			asm_file << "_stacky_memcpy_string:\n";
+			asm_file << "	rep movsb\n";
+			asm_file << "	ret\n";
+			asm_file << "_stacky_memcpy_bytes:\n";
+			asm_file << "	xor edx, edx\n";
+			asm_file << "_stacky_memcpy_byte:\n";
+			asm_file << "	cmp rdx, rcx\n";
+			asm_file << "	jae _stacky_memcpy_done\n";
+			asm_file << "	mov al, [rsi+rdx]\n";
+			asm_file << "	mov [rdi+rdx], al\n";
+			asm_file << "	inc rdx\n";
+			asm_file << "	jmp _stacky_memcpy_byte\n";
+			asm_file << "_stacky_memcpy_done:\n";
+			asm_file << "	ret\n";
+		}
+
+		// Copy to higher address that overlaps source goes from the end, first block is loaded before any store
+		if (uses(Intrinsic_Kind::Memory_Move)) {
+			asm_file << "_stacky_memmove:\n";
+			asm_file << "	mov rax, rdi\n";
+			asm_file << "	sub rax, rsi\n";
+			asm_file << "	cmp rax, rcx\n";
+			asm_file << "	jae _stacky_memcpy\n";
+			asm_file << "	cmp rcx, " << block << '\n';
+			asm_file << "	jb _stacky_memmove_byte\n";
+			asm_file << '\t' << v << "movdqu " << reg(1) << ", [rsi]\n";
+			asm_file << "_stacky_memmove_block:\n";
+			asm_file << "	sub rcx, " << block << '\n';
+			asm_file << '\t' << v << "movdqu " << reg(0) << ", [rsi+rcx]\n";
+			asm_file << '\t' << v << "movdqu [rdi+rcx], " << reg(0) << '\n';
+			asm_file << "	cmp rcx, " << block << '\n';
+			asm_file << "	ja _stacky_memmove_block\n";
+			asm_file << '\t' << v << "movdqu [rdi], " << reg(1) << '\n';
+			asm_file << ret;
+			asm_file << "_stacky_memmove_byte:\n";
+			asm_file << "	test rcx, rcx\n";
+			asm_file << "	jz _stacky_memmove_done\n";
+			asm_file << "	dec rcx\n";
+			asm_file << "	mov al, [rsi+rcx]\n";
+			asm_file << "	mov [rdi+rcx], al\n";
+			asm_file << "	jmp _stacky_memmove_byte\n";
+			asm_file << "_stacky_memmove_done:\n";
+			asm_file << "	ret\n";
+		}
+
+		if (uses(Intrinsic_Kind::Memory_Set)) {
+			asm_file << "_stacky_memset:\n";
+			asm_file << "	cmp rcx, " << block << '\n';
+			asm_file << "	jb _stacky_memset_byte\n";
+			asm_file << "	cmp rcx, " << Min_String_Size << '\n';
+			asm_file << "	jae _stacky_memset_string\n";
+			broadcast();
+			asm_file << "	lea rdx, [rcx-" << block << "]\n";
+			asm_file << "	xor esi, esi\n";
+			asm_file << "_stacky_memset_block:\n";
+			asm_file << '\t' << v << "movdqu [rdi+rsi], " << reg(0) << '\n';
+			asm_file << "	add rsi, " << block << '\n';
+			asm_file << "	cmp rsi, rdx\n";
+			asm_file << "	jb _stacky_memset_block\n";
+			asm_file << '\t' << v << "movdqu [rdi+rdx], " << reg(0) << '\n';
+			asm_file << ret;
+			asm_file << "_stacky_memset_string:\n";
+			asm_file << "	rep stosb\n";
+			asm_file << "	ret\n";
+			asm_file << "_stacky_memset_byte:\n";
+			asm_file << "	test rcx, rcx\n";
+			asm_file << "	jz _stacky_memset_done\n";
+			asm_file << "	dec rcx\n";
+			asm_file << "	mov [rdi+rcx], al\n";
+			asm_file << "	jmp _stacky_memset_byte\n";
+			asm_file << "_stacky_memset_done:\n";
+			asm_file << "	ret\n";
+		}
+
+		// Result is difference of first bytes that differ, blocks that are equal have all mask bits set
+		if (uses(Intrinsic_Kind::Memory_Compare)) {
+			asm_file << "_stacky_memcmp:\n";
+			asm_file << "	cmp rcx, " << block << '\n';
+			asm_file << "	jb _stacky_memcmp_byte\n";
+			asm_file << '\t' << v << "movdqu " << reg(0) << ", [rdi]\n";
+			asm_file << '\t' << v << "movdqu " << reg(1) << ", [rsi]\n";
+			asm_file << (avx2 ? "	vpcmpeqb ymm0, ymm0, ymm1\n" : "	pcmpeqb xmm0, xmm1\n");
+			asm_file << '\t' << v << "pmovmskb edx, " << reg(0) << '\n';
+			asm_file << "	xor edx, " << (avx2 ? "-1" : "0xFFFF") << '\n';
+			asm_file << "	jnz _stacky_memcmp_differs\n";
+			asm_file << "	add rdi, " << block << '\n';
+			asm_file << "	add rsi, " << block << '\n';
+			asm_file << "	sub rcx, " << block << '\n';
+			asm_file << "	jmp _stacky_memcmp\n";
+			asm_file << "_stacky_memcmp_differs:\n";
+			asm_file << "	bsf edx, edx\n";
+			asm_file << "	movzx eax, byte [rdi+rdx]\n";
+			asm_file << "	movzx edx, byte [rsi+rdx]\n";
+			asm_file << "	sub rax, rdx\n";
+			asm_file << ret;
+			asm_file << "_stacky_memcmp_byte:\n";
+			asm_file << "	xor eax, eax\n";
+			asm_file << "	test rcx, rcx\n";
+			asm_file << "	jz _stacky_memcmp_done\n";
+			asm_file << "	movzx eax, byte [rdi]\n";
+			asm_file << "	movzx edx, byte [rsi]\n";
+			asm_file << "	sub rax, rdx\n";
+			asm_file << "	jnz _stacky_memcmp_done\n";
+			asm_file << "	inc rdi\n";
+			asm_file << "	inc rsi\n";
+			asm_file << "	dec rcx\n";
+			asm_file << "	jmp _stacky_memcmp_byte\n";
+			asm_file << "_stacky_memcmp_done:\n";
+			asm_file << ret;
+		}
+
+		if (uses(Intrinsic_Kind::Memory_Find)) {
+			asm_file << "_stacky_memchr:\n";
+			broadcast();
+			asm_file << "_stacky_memchr_block:\n";
+			asm_file << "	cmp rcx, " << block << '\n';
+			asm_file << "	jb _stacky_memchr_byte\n";
+			asm_file << (avx2 ? "	vpcmpeqb ymm1, ymm0, [rdi]\n" : "	movdqu xmm1, [rdi]\n	pcmpeqb xmm1, xmm0\n");
+			asm_file << '\t' << v << "pmovmskb edx, " << reg(1) << '\n';
+			asm_file << "	test edx, edx\n";
+			asm_file << "	jnz _stacky_memchr_found\n";
+			asm_file << "	add rdi, " << block << '\n';
+			asm_file << "	sub rcx, " << block << '\n';
+			asm_file << "	jmp _stacky_memchr_block\n";
+			asm_file << "_stacky_memchr_found:\n";
+			asm_file << "	bsf edx, edx\n";
+			asm_file << "	lea rax, [rdi+rdx]\n";
+			asm_file << ret;
+			asm_file << "_stacky_memchr_byte:\n";
+			asm_file << "	mov rdx, rdi\n";
+			asm_file << "	test rcx, rcx\n";
+			asm_file << "	jz _stacky_memchr_missing\n";
+			asm_file << "	cmp [rdi], al\n";
+			asm_file << "	je _stacky_memchr_done\n";
+			asm_file << "	inc rdi\n";
+			asm_file << "	dec rcx\n";
+			asm_file << "	jmp _stacky_memchr_byte\n";
+			asm_file << "_stacky_memchr_missing:\n";
+			asm_file << "	xor edx, edx\n";
+			asm_file << "_stacky_memchr_done:\n";
+			asm_file << "	mov rax, rdx\n";
+			asm_file << ret;
+		}
+	}
+
+	// Idiom leaves stack as its loop would before final check of the condition, so that loop ends right away.
+	// Loops with few iterations are left to run, string instructions take some time to start.
+	auto emit_idiom(vectorizer::Idiom const& idiom, std::ostream& asm_file, std::string const& label)
+	{
+		static constexpr unsigned Min_String_Instruction_Count = 16;
+
+		auto const operand = [&](vectorizer::Operand const& operand) {
+			switch (operand.kind) {
+			case vectorizer::Operand::Kind::Constant:  return std::to_string(operand.value);
+			case vectorizer::Operand::Kind::Symbol:    return std::format("{}{}", operand.symbol_prefix, operand.value);
+			case vectorizer::Operand::Kind::Parameter: return std::format("[rsp+{}]", 8 * operand.value);
+			}
+			unreachable("Operands of idioms are constants, symbols or values on the stack");
+		};
+
+		// Address of element at counter (in rax) into given register
+		auto const element = [&](std::string_view reg, vectorizer::Operand const& base, std::int64_t offset) {
+			auto const displacement = offset ? std::format("{:+}", offset) : "";
+			if (base.kind == vectorizer::Operand::Kind::Symbol) {
+				asm_file << "	lea " << reg << ", [" << operand(base) << "+rax" << displacement << "]\n";
+				return;
+			}
+			asm_file << "	mov " << reg << ", " << operand(base) << '\n';
+			asm_file << "	lea " << reg << ", [" << reg << "+rax" << displacement << "]\n";
+		};
+
+		switch (idiom.kind) {
+		case vectorizer::Idiom::Kind::Length:
+			// Aligned blocks never cross page boundary, bytes before the string are masked out
+			asm_file << "	;; string length\n";
+			asm_file << "	mov rbx, [rsp]\n";
+			asm_file << "	mov ecx, ebx\n";
+			asm_file << "	and ecx, 15\n";
+			asm_file << "	and rbx, -16\n";
+			asm_file << "	pxor xmm0, xmm0\n";
+			asm_file << "	pcmpeqb xmm0, [rbx]\n";
+			asm_file << "	pmovmskb edx, xmm0\n";
+			asm_file << "	shr edx, cl\n";
+			asm_file << "	shl edx, cl\n";
+			asm_file << "	jmp " << label << "_test\n";
+			asm_file << label << "_scan:\n";
+			asm_file << "	add rbx, 16\n";
+			asm_file << "	pxor xmm0, xmm0\n";
+			asm_file << "	pcmpeqb xmm0, [rbx]\n";
+			asm_file << "	pmovmskb edx, xmm0\n";
+			asm_file << label << "_test:\n";
+			asm_file << "	test edx, edx\n";
+			asm_file << "	jz " << label << "_scan\n";
+			asm_file << "	bsf edx, edx\n";
+			asm_file << "	add rbx, rdx\n";
+			asm_file << "	mov [rsp], rbx\n";
+			break;
+
+		case vectorizer::Idiom::Kind::Compare:
+			// 16 bytes are compared at once when neither of them crosses page boundary, otherwise one byte
+			asm_file << "	;; string compare\n";
+			asm_file << "	mov rax, [rsp+8]\n";
+			asm_file << "	mov rdx, [rsp]\n";
+			asm_file << label << "_compare:\n";
+			asm_file << "	mov ecx, eax\n";
+			asm_file << "	and ecx, 4095\n";
+			asm_file << "	cmp ecx, 4080\n";
+			asm_file << "	ja " << label << "_byte\n";
+			asm_file << "	mov ecx, edx\n";
+			asm_file << "	and ecx, 4095\n";
+			asm_file << "	cmp ecx, 4080\n";
+			asm_file << "	ja " << label << "_byte\n";
+			asm_file << "	movdqu xmm0, [rax]\n";
+			asm_file << "	movdqu xmm1, [rdx]\n";
+			asm_file << "	pcmpeqb xmm1, xmm0\n";
+			asm_file << "	pxor xmm2, xmm2\n";
+			asm_file << "	pcmpeqb xmm2, xmm0\n";
+			asm_file << "	pandn xmm2, xmm1\n";
+			asm_file << "	pmovmskb ecx, xmm2\n";
+			asm_file << "	cmp ecx, 0xFFFF\n";
+			asm_file << "	jne " << label << "_differs\n";
+			asm_file << "	add rax, 16\n";
+			asm_file << "	add rdx, 16\n";
+			asm_file << "	jmp " << label << "_compare\n";
+			asm_file << label << "_byte:\n";
+			asm_file << "	movzx ecx, byte [rax]\n";
+			asm_file << "	cmp cl, [rdx]\n";
+			asm_file << "	jne " << label << "_compared\n";
+			asm_file << "	test ecx, ecx\n";
+			asm_file << "	jz " << label << "_compared\n";
+			asm_file << "	inc rax\n";
+			asm_file << "	inc rdx\n";
+			asm_file << "	jmp " << label << "_compare\n";
+			asm_file << label << "_differs:\n";
+			asm_file << "	not ecx\n";
+			asm_file << "	bsf ecx, ecx\n";
+			asm_file << "	add rax, rcx\n";
+			asm_file << "	add rdx, rcx\n";
+			asm_file << label << "_compared:\n";
+			asm_file << "	mov [rsp+8], rax\n";
+			asm_file << "	mov [rsp], rdx\n";
+			break;
+
+		case vectorizer::Idiom::Kind::Fill:
+		case vectorizer::Idiom::Kind::Copy:
+			{
+				auto const fill = idiom.kind == vectorizer::Idiom::Kind::Fill;
+				asm_file << "	;; " << (fill ? "fill" : "copy") << '\n';
+				asm_file << "	mov rcx, " << operand(idiom.bound) << '\n';
+				asm_file << "	mov rax, [rsp]\n";
+				asm_file << "	sub rcx, rax\n";
+				asm_file << "	jbe " << label << "_scalar\n";
+				asm_file << "	cmp rcx, " << Min_String_Instruction_Count << '\n';
+				asm_file << "	jb " << label << "_scalar\n";
+				element("rdi", idiom.destination, idiom.destination_offset);
+				if (fill) {
+					asm_file << "	mov rax, " << operand(idiom.value) << '\n';
+				} else {
+					element("rsi", idiom.source, idiom.source_offset);
+				}
+				asm_file << "	add [rsp], rcx\n";
+				asm_file << (fill ? "	rep stosb\n" : "	rep movsb\n");
+				asm_file << label << "_scalar:\n";
+			}
+			break;
+		}
+	}
+
+	// Loop recognized by vectorizer runs first over as many elements as fit in vector registers, while
+	// at least that many remain, and then scalar loop follows it with elements that are left.
+	// Node n is kept in xmm<n>, sums in xmm10 and xmm11, and xmm12 to xmm15 hold zero, scratch value,
+	// sign bits (unsigned comparison is signed comparison of values with flipped sign bits) and all ones.
+	auto emit_vectorized_loop(vectorizer::Loop const& loop, std::ostream& asm_file, std::string const& label)
+	{
+		auto const avx2 = compiler_arguments.avx2;
+		auto const size = loop.element_size == 1 ? 'b' : 'd';
+
+		auto const reg = [&](unsigned n) { return std::format("{}mm{}", avx2 ? 'y' : 'x', n); };
+		auto const acc = [&](unsigned r) { return reg(10 + r); };
+		auto const zero = reg(12), scratch = reg(13), bias = reg(14), ones = reg(15);
+
+		// target = lhs <instruction> rhs
+		auto const emit = [&](std::string_view instruction, std::string const& target, std::string const& lhs, std::string const& rhs) {
+			if (avx2) {
+				asm_file << "	v" << instruction << ' ' << target << ", " << lhs << ", " << rhs << '\n';
+				return;
+			}
+			if (target != lhs)
+				asm_file << "	movdqa " << target << ", " << lhs << '\n';
+			asm_file << '	' << instruction << ' ' << target << ", " << rhs << '\n';
+		};
+
+		// Value of eax in every lane
+		auto const broadcast = [&](unsigned n) {
+			if (avx2) {
+				asm_file << "	vmovd xmm" << n << ", eax\n";
+				asm_file << "	vpbroadcastd ymm" << n << ", xmm" << n << '\n';
+			} else {
+				asm_file << "	movd xmm" << n << ", eax\n";
+				asm_file << "	pshufd xmm" << n << ", xmm" << n << ", 0\n";
+			}
+		};
+		auto const element = [&](std::string_view prefix, std::uint64_t symbol, std::int64_t offset) {
+			return std::format("[{}{}+rcx*{}{}]", prefix, symbol, loop.element_size, offset ? std::format("{:+}", offset) : "");
+		};
+		auto const pattern = [&](std::uint64_t value) {
+			return loop.element_size == 1 ? (value & 0xff) * 0x01010101 : value & 0xffffffff;
+		};
+
+		// Unsigned comparison of lhs > rhs
+		auto const greater = [&](std::string const& target, std::string const& lhs, std::string const& rhs) {
+			emit("pxor", scratch, rhs, bias);
+			emit("pxor", target, lhs, bias);
+			emit(std::format("pcmpgt{}", size), target, target, scratch);
+		};
+
+		auto const bound = loop.bound - loop.lanes;
+		asm_file << "	;; vectorized loop\n";
+		asm_file << "	mov rcx, [rsp]\n";
+		asm_file << "	mov rdx, " << bound << '\n';
+		asm_file << "	cmp rcx, rdx\n";
+		asm_file << "	ja " << label << "_scalar\n";
+
+		// Preheader
+		emit("pxor", zero, zero, zero);
+		emit("pcmpeqd", ones, ones, ones);
+		asm_file << "	mov eax, " << (loop.element_size == 1 ? 0x80808080 : 0x80000000) << '\n';
+		broadcast(14);
+		for (auto r = 0u; r < loop.reductions.size(); ++r)
+			emit("pxor", acc(r), acc(r), acc(r));
+		for (auto n = 0u; n < loop.nodes.size(); ++n) {
+			auto const& v = loop.nodes[n];
+			switch (v.kind) {
+			case vectorizer::Node::Kind::Constant:
+				asm_file << "	mov eax, " << pattern(v.value) << '\n';
+				broadcast(n);
+				break;
+			case vectorizer::Node::Kind::Parameter:
+				if (loop.element_size == 1) {
+					asm_file << "	movzx eax, byte [rsp+" << 8 * v.value << "]\n";
+					asm_file << "	imul eax, eax, 0x01010101\n";
+				} else {
+					asm_file << "	mov eax, [rsp+" << 8 * v.value << "]\n";
+				}
+				broadcast(n);
+				break;
+			default:
+				;
+			}
+		}
+
+		emit_loop_alignment(asm_file);
+		asm_file << label << "_vector:\n";
+		for (auto n = 0u; n < loop.nodes.size(); ++n) {
+			auto const& v = loop.nodes[n];
+			auto const target = reg(n);
+			auto const input = [&](unsigned k) { return reg(v.inputs[k]); };
+
+			switch (v.kind) {
+			case vectorizer::Node::Kind::Constant:
+			case vectorizer::Node::Kind::Parameter:
+				break;
+
+			case vectorizer::Node::Kind::Load:
+				asm_file << (avx2 ? "	vmovdqu " : "	movdqu ") << target << ", " << element(v.symbol_prefix, v.value, v.offset) << '\n';
+				break;
+
+			case vectorizer::Node::Kind::Select:
+				emit("pand", target, input(0), input(1));
+				emit("pandn", scratch, input(0), input(2));
+				emit("por", target, target, scratch);
+				break;
+
+			case vectorizer::Node::Kind::Intrinsic:
+				switch (v.intrinsic) {
+				case Intrinsic_Kind::Add:            emit(std::format("padd{}", size), target, input(0), input(1)); break;
+				case Intrinsic_Kind::Subtract:       emit(std::format("psub{}", size), target, input(0), input(1)); break;
+				case Intrinsic_Kind::Boolean_And:
+				case Intrinsic_Kind::Bitwise_And:    emit("pand", target, input(0), input(1)); break;
+				case Intrinsic_Kind::Boolean_Or:
+				case Intrinsic_Kind::Bitwise_Or:     emit("por", target, input(0), input(1)); break;
+				case Intrinsic_Kind::Bitwise_Xor:    emit("pxor", target, input(0), input(1)); break;
+				case Intrinsic_Kind::Boolean_Negate: emit("pxor", target, input(0), ones); break;
+				case Intrinsic_Kind::Min:            emit(std::format("pminu{}", size), target, input(0), input(1)); break;
+				case Intrinsic_Kind::Max:            emit(std::format("pmaxu{}", size), target, input(0), input(1)); break;
+
+				case Intrinsic_Kind::Equal:
+				case Intrinsic_Kind::Not_Equal:
+					emit(std::format("pcmpeq{}", size), target, input(0), input(1));
+					if (v.intrinsic == Intrinsic_Kind::Not_Equal)
+						emit("pxor", target, target, ones);
+					break;
+
+				case Intrinsic_Kind::Greater:    greater(target, input(0), input(1)); break;
+				case Intrinsic_Kind::Less:       greater(target, input(1), input(0)); break;
+				case Intrinsic_Kind::Less_Eq:    greater(target, input(0), input(1)); emit("pxor", target, target, ones); break;
+				case Intrinsic_Kind::Greater_Eq: greater(target, input(1), input(0)); emit("pxor", target, target, ones); break;
+
+				// Bytes are shifted as words, bits that crossed into neighbouring byte are cleared by mask
+				case Intrinsic_Kind::Left_Shift:
+				case Intrinsic_Kind::Right_Shift:
+					emit(std::format("ps{}l{}", v.intrinsic == Intrinsic_Kind::Left_Shift ? 'l' : 'r', loop.element_size == 1 ? 'w' : 'd'),
+						target, input(0), std::to_string(v.value));
+					if (loop.element_size == 1)
+						emit("pand", target, target, input(1));
+					break;
+
+				default:
+					unreachable("Vectorizer produces only supported intrinsics");
+				}
+				break;
+			}
+		}
+
+		for (auto const& store : loop.stores)
+			asm_file << (avx2 ? "	vmovdqu " : "	movdqu ") << element(store.symbol_prefix, store.symbol, store.offset) << ", " << reg(store.value) << '\n';
+
+		// Sums of lanes are accumulated in 64 bit parts of registers
+		for (auto r = 0u; r < loop.reductions.size(); ++r) {
+			auto const value = reg(loop.reductions[r].value);
+			if (loop.element_size == 1) {
+				emit("psadbw", scratch, value, zero);
+				emit("paddq", acc(r), acc(r), scratch);
+			} else {
+				emit("punpckldq", scratch, value, zero);
+				emit("paddq", acc(r), acc(r), scratch);
+				emit("punpckhdq", scratch, value, zero);
+				emit("paddq", acc(r), acc(r), scratch);
+			}
+		}
+
+		asm_file << "	add rcx, " << loop.lanes << '\n';
+		asm_file << "	cmp rcx, rdx\n";
+		asm_file << "	jbe " << label << "_vector\n";
+
+		for (auto r = 0u; r < loop.reductions.size(); ++r) {
+			auto const sum = std::format("xmm{}", 10 + r);
+			if (avx2) {
+				asm_file << "	vextracti128 xmm13, " << acc(r) << ", 1\n";
+				asm_file << "	vpaddq " << sum << ", " << sum << ", xmm13\n";
+			}
+			asm_file << (avx2 ? "	vpshufd xmm13, " : "	pshufd xmm13, ") << sum << ", 0xEE\n";
+			asm_file << (avx2 ? "	vpaddq " : "	paddq ") << sum << ", " << (avx2 ? sum + ", " : "") << "xmm13\n";
+			asm_file << (avx2 ? "	vmovq rax, " : "	movq rax, ") << sum << '\n';
+			asm_file << "	add [rsp+" << 8 * loop.reductions[r].depth << "], rax\n";
+		}
+		asm_file << "	mov [rsp], rcx\n";
+		if (avx2)
+			asm_file << "	vzeroupper\n";
+		asm_file << label << "_scalar:\n";
+	}
+
+	auto generate_instructions([[maybe_unused]] Generation_Info const& geninfo, std::vector<Operation> const& ops, std::ostream& asm_file, Program_Context &program, std::string_view instr_prefix, std::string_view name = {}) -> void
+	{
+		// Longest condition that may be fused with following branch
+		static constexpr unsigned Max_Condition_Length = 8;
+
+		// Invariants of currently generated loop, computed once before it into registers
+		unsigned hoisting_loop = Operation::Empty_Jump;
+		std::vector<Loop_Invariant> invariants;
+
+		// First operations of cold branches whose `if` was already generated, with ends of the branches
+		std::unordered_map<unsigned, unsigned> pending_cold;
+
+		// Increments execution counter of instrumented executable
+		auto const count_execution = [&](Operation const& op, Profile_Counter counter) {
+			if (!compiler_arguments.profile_generate)
+				return;
+			asm_file << "	inc qword [_stacky_profile+" << 16 * program.profile_keys.size() + 8 << "]\n";
+			program.profile_keys.push_back(Profile::key(op.location, counter));
+		};
+
+		// Counts how many times each address taken function is target of `call`, from address on top of the stack
+		auto const count_call_targets = [&](Operation const& op) {
+			if (!compiler_arguments.profile_generate || program.call_targets.empty())
+				return;
+			asm_file << "	;; count call targets\n";
+			asm_file << "	mov rax, [rsp]\n";
+			for (auto const& [id, target] : program.call_targets) {
+				asm_file << "	xor ecx, ecx\n";
+				asm_file << "	cmp rax, " << Function_Prefix << id << '\n';
+				asm_file << "	sete cl\n";
+				asm_file << "	add [_stacky_profile+" << 16 * program.profile_keys.size() + 8 << "], rcx\n";
+				program.profile_keys.push_back(Profile::key(op.location, Profile_Counter::Call_Target, target));
+			}
+		};
+
+		// Emits operation at index `i` (possibly fused with following ones), returns number of consumed operations.
+		// Branch of `if` or `do` goes to `rotated` target when given.
+		std::function<unsigned(unsigned, std::optional<Branch_Target> const&)> emit_operation;
+		emit_operation = [&](unsigned i, std::optional<Branch_Target> const& rotated) -> unsigned {
+			auto const& op = ops[i];
+
+			if (hoisting_loop != Operation::Empty_Jump) {
+				auto const invariant = std::find_if(std::cbegin(invariants), std::cend(invariants), [&](auto const& invariant) { return invariant.first == i; });
+				if (invariant != std::cend(invariants)) {
+					asm_file << "	;; loop invariant\n";
+					asm_file << "	push " << invariant->reg << '\n';
+					return invariant->last - i + 1;
+				}
+			}
+
+			if (auto const consumed = emit_condition_branch(geninfo, ops, i, asm_file, instr_prefix, name, rotated); consumed > 0)
+				return consumed;
+
+			if (auto const consumed = emit_fused_memory_access(geninfo, ops, i, asm_file, name); consumed > 0)
+				return consumed;
+
+			if (auto const consumed = emit_strength_reduced(geninfo, ops, i, asm_file, name); consumed > 0)
+				return consumed;
+
+			if (auto const consumed = emit_immediate_operand(geninfo, ops, i, asm_file, instr_prefix, name, rotated); consumed > 0)
+				return consumed;
+
+			if (auto const consumed = emit_bulk_memory(geninfo, ops, i, asm_file, program, name); consumed > 0)
+				return consumed;
+
+			switch (op.kind) {
+			case Operation::Kind::Intrinsic:
+				if (op.intrinsic == Intrinsic_Kind::Call)
+					count_call_targets(op);
+				emit_intrinsic(op, asm_file);
+				break;
+			case Operation::Kind::Cast:
+				asm_file << "	;; cast " << op.token.sval << "\n";
+				break;
+			case Operation::Kind::Call_Symbol:
+				// Callee that returns to our caller can reuse our call stack entry,
+				// so tail call is a jump past callee prologue (and tail recursion is a loop)
+				count_execution(op, Profile_Counter::Call);
+				if (!name.empty() && is_tail_position(ops, i)) {
+					asm_file << "	;; tail call symbol\n";
+					asm_file << "	jmp " << Function_Entry_Prefix << op.ival << '\n';
+					break;
+				}
+				if (auto const callee = program.register_functions.find(op.ival); callee != std::end(program.register_functions)) {
+					asm_file << "	;; call symbol with arguments in registers\n";
+					for (auto reg = callee->second.inputs; reg-- > 0;)
+						asm_file << "	pop " << Call_Registers[reg] << '\n';
+					asm_file << "	call " << Function_Register_Prefix << op.ival << '\n';
+					for (auto reg = 0u; reg < callee->second.outputs; ++reg)
+						asm_file << "	push " << Call_Registers[reg] << '\n';
+					break;
+				}
+				asm_file << "	;; call symbol\n";
+				asm_file << "	call " << Function_Prefix << op.ival << '\n';
+				break;
+			case Operation::Kind::Push_Symbol:
+			case Operation::Kind::Push_Int:
+				emit_push(op, asm_file);
+				break;
+			case Operation::Kind::Return:
+				asm_file << "	;; return\n";
+				asm_file << "	jmp " << instr_prefix << ops.size() << '\n';
+				break;
+			case Operation::Kind::End:
+				assert(op.jump != Operation::Empty_Jump);
+				asm_file << "	;; end\n";
+				if (op.jump < i && ops[op.jump].kind == Operation::Kind::While) {
+					if (auto const do_op = rotated_loop_condition(ops, op.jump)) {
+						asm_file << "	;; rotated loop condition\n";
+						Branch_Target const body { std::format("{}{}_body", instr_prefix, *do_op), true };
+						for (auto j = op.jump + 1; j <= *do_op;)
+							j += emit_operation(j, body);
+						if (hoisting_loop == op.jump)
+							hoisting_loop = Operation::Empty_Jump;
+						break;
+					}
+				}
+				if (hoisting_loop == op.jump) {
+					asm_file << "	jmp " << instr_prefix << op.jump << "_loop\n";
+					hoisting_loop = Operation::Empty_Jump;
+					break;
+				}
+				if (i + 1 != op.jump)
+					asm_file << "	jmp " << instr_prefix << op.jump << '\n';
+				break;
+			case Operation::Kind::Do:
+			case Operation::Kind::If:
+				{
+					auto const target = rotated ? *rotated : default_branch_target(op, instr_prefix);
+					asm_file << "	;; if | do\n";
+					asm_file << "	pop rax\n";
+					asm_file << "	test rax, rax\n";
+					asm_file << "	j" << (target.when_true ? "nz " : "z ") << target.label << '\n';
+				}
+				break;
+			case Operation::Kind::Else:
+				assert(op.jump != Operation::Empty_Jump);
+				asm_file << "	;; else\n";
+				// Cold `else` body is moved away, so `end` follows directly
+				if (!pending_cold.contains(i + 1))
+					asm_file << "	jmp " << instr_prefix << op.jump << '\n';
+				break;
+			case Operation::Kind::While:
+				asm_file << "	;; while\n";
+				if (hoisting_loop != Operation::Empty_Jump)
+					break;
+				invariants = find_loop_invariants(geninfo, ops, i, name);
+				if (invariants.empty())
+					break;
+
+				// Preheader, executed once before loop
+				hoisting_loop = i;
+				for (auto const& invariant : invariants) {
+					if (std::any_of(std::cbegin(invariants), std::cbegin(invariants) + (&invariant - invariants.data()),
+								[&](auto const& previous) { return previous.reg == invariant.reg; }))
+						continue;
+
+					asm_file << "	;; hoisted loop invariant\n";
+					for (auto j = invariant.first; j <= invariant.last; ++j) {
+						switch (ops[j].kind) {
+						case Operation::Kind::Intrinsic: emit_intrinsic(ops[j], asm_file); break;
+						case Operation::Kind::Cast:      break;
+						default:                         emit_push(ops[j], asm_file);
+						}
+					}
+					asm_file << "	pop " << invariant.reg << '\n';
+				}
+				emit_loop_alignment(asm_file);
+				asm_file << instr_prefix << i << "_loop:\n";
+				break;
+			}
+			return 1;
+		};
+
+		// Comparisons of dispatch chains are replaced by dispatch emitted in place of the first one
+		auto const dispatches = find_dispatch_chains(geninfo, ops, name);
+		std::unordered_map<unsigned, Dispatch_Chain const*> dispatch_links;
+		for (auto const& chain : dispatches)
+			for (auto const link : chain.links)
+				dispatch_links[link] = &chain;
+
+		auto cold_branches = find_cold_branches(geninfo.profile, ops, program.exiting_functions);
+		for (auto const& chain : dispatches)
+			for (auto const link : chain.links)
+				cold_branches.erase(link + 3);
+
+		// `if` operations owning entries of `else` bodies and `end`s of `if` without `else`, which are counted
+		std::unordered_map<unsigned, unsigned> else_entries, join_entries;
+		for (auto i = 0u; i < ops.size(); ++i)
+			if (ops[i].kind == Operation::Kind::If)
+				(ops[ops[i].jump - 1].kind == Operation::Kind::Else ? else_entries : join_entries)[ops[i].jump] = i;
+
+		// While cold branch is generated, output goes to cold code and hot code is kept aside
+		unsigned cold_end = Operation::Empty_Jump;
+		std::streambuf *hot_code = nullptr;
+
+		auto const leave_cold_branch = [&](unsigned i) {
+			if (ops[i-1].kind != Operation::Kind::Else && ops[i-1].kind != Operation::Kind::Return)
+				asm_file << "	jmp " << instr_prefix << i << '\n';
+			asm_file.rdbuf(hot_code);
+			cold_end = Operation::Empty_Jump;
+		};
+
+		for (auto i = 0u; i < ops.size();) {
+			if (cold_end == i)
+				leave_cold_branch(i);
+
+			if (auto const cold = pending_cold.find(i); cold != std::end(pending_cold)) {
+				hot_code = asm_file.rdbuf(program.cold_code.rdbuf());
+				asm_file << instr_prefix << i << "_cold:\n";
+				cold_end = cold->second;
+				pending_cold.erase(cold);
+				if (cold_end == i)
+					leave_cold_branch(i);
+			}
+
+			// `if` body is entered only by falling through
+			if (i > 0 && ops[i-1].kind == Operation::Kind::If)
+				count_execution(ops[i-1], Profile_Counter::Then);
+
+			// Idiom and vectorized part of loop are placed before loop header, since back edge of loop that is not rotated goes there
+			if (ops[i].kind == Operation::Kind::While) {
+				if (auto const idiom = vectorizer::recognize_idiom(ops, i)) {
+					verbose(ops[i].token, "Replacing loop with idiom");
+					emit_idiom(*idiom, asm_file, std::format("{}{}", instr_prefix, i));
+				} else if (auto const loop = vectorizer::analyze(ops, i)) {
+					verbose(ops[i].token, std::format("Vectorized loop processing {} elements at once", loop->lanes));
+					emit_vectorized_loop(*loop, asm_file, std::format("{}{}", instr_prefix, i));
+				}
+			}
+
+			// Loop header is aligned, so that back edge lands on the start of fetch block
+			if (ops[i].kind == Operation::Kind::While && !rotated_loop_condition(ops, i))
+				emit_loop_alignment(asm_file);
+
+			if (geninfo.jump_targets_lookup.contains({ name, i }))
+				asm_file << instr_prefix << i << ":\n";
+
+			// Label of loop header is also target of its back edge
+			if (auto const owner = else_entries.find(i); owner != std::end(else_entries) && ops[i].kind != Operation::Kind::While)
+				count_execution(ops[owner->second], Profile_Counter::Else);
+			if (auto const owner = join_entries.find(i); owner != std::end(join_entries))
+				count_execution(ops[owner->second], Profile_Counter::Join);
+
+			if (auto const link = dispatch_links.find(i); link != std::cend(dispatch_links)) {
+				if (link->second->links.front() == i)
+					emit_dispatch(*link->second, asm_file, instr_prefix);
+				i += 4;
+				asm_file << instr_prefix << i - 1 << "_case:\n";
+				continue;
+			}
+
+			if (i > 0 && ops[i-1].kind == Operation::Kind::Do) {
+				// Body of rotated loop is entered from repeated condition at its end
+				auto const while_op = ops[ops[i-1].jump - 1].jump;
+				if (rotated_loop_condition(ops, while_op) == i - 1) {
+					emit_loop_alignment(asm_file);
+					asm_file << instr_prefix << i - 1 << "_body:\n";
+				}
+				count_execution(ops[i-1], Profile_Counter::Loop_Body);
+			}
+
+			// Cold branch is entered by conditional jump, hot path falls through.
+			// Branch may be fused with condition starting few operations before it.
+			std::optional<unsigned> next_branch = std::nullopt;
+			for (auto j = i; cold_end == Operation::Empty_Jump && j < std::min(i + Max_Condition_Length, unsigned(ops.size())); ++j) {
+				if (ops[j].kind == Operation::Kind::If || ops[j].kind == Operation::Kind::Do) {
+					next_branch = j;
+					break;
+				}
+			}
+
+			if (auto const cold = next_branch ? cold_branches.find(*next_branch) : std::end(cold_branches); cold != std::end(cold_branches)) {
+				auto const [branch, first] = *cold;
+				i += emit_operation(i, Branch_Target { std::format("{}{}_cold", instr_prefix, first), first == branch + 1 });
+				if (branch < i)
+					pending_cold[first] = first == branch + 1 ? ops[branch].jump : ops[ops[branch].jump - 1].jump;
+				continue;
+			}
+
+			i += emit_operation(i, std::nullopt);
+		}
+
+		asm_file << instr_prefix << ops.size() << ":";
+	}
+
+	// Instrumented executable keeps (key, count) pairs of all counters in `_stacky_profile` and appends
+	// them to profile file just before `exit` or `exit_group` syscall, so that runs of many workloads add up.
+	// Routine is called with syscall number in rax and preserves all registers used by the syscall.
+	auto emit_profile_writer(Program_Context const& program, std::ostream& asm_file)
+	{
+		static constexpr unsigned Open_Flags = 02101; // O_WRONLY | O_CREAT | O_APPEND
+
+		asm_file << "_stacky_profile_exit:\n";
+		asm_file << "	cmp rax, 60\n";
+		asm_file << "	je _stacky_profile_write\n";
+		asm_file << "	cmp rax, 231\n";
+		asm_file << "	je _stacky_profile_write\n";
+		asm_file << "	ret\n";
+		asm_file << "_stacky_profile_write:\n";
+		asm_file << "	push rax\n";
+		asm_file << "	push rdi\n";
+		asm_file << "	mov rax, 2\n";
+		asm_file << "	mov rdi, _stacky_profile_path\n";
+		asm_file << "	mov rsi, " << Open_Flags << "\n";
+		asm_file << "	mov rdx, 420\n";
+		asm_file << "	syscall\n";
+		asm_file << "	test rax, rax\n";
+		asm_file << "	js _stacky_profile_done\n";
+		asm_file << "	mov rdi, rax\n";
+		asm_file << "	mov rax, 1\n";
+		asm_file << "	mov rsi, _stacky_profile\n";
+		asm_file << "	mov rdx, " << 16 * program.profile_keys.size() << "\n";
+		asm_file << "	syscall\n";
+		asm_file << "	mov rax, 3\n";
+		asm_file << "	syscall\n";
+		asm_file << "_stacky_profile_done:\n";
+		asm_file << "	pop rdi\n";
+		asm_file << "	pop rax\n";
+		asm_file << "	ret\n";
+
+		asm_file << "segment .data\n";
+		asm_file << "_stacky_profile_path: db ";
+		for (auto c : compiler_arguments.profile_output.string())
+			asm_file << int(c) << ',';
+		asm_file << "0\n";
+		asm_file << "align 8\n";
+		asm_file << "_stacky_profile:\n";
+		for (auto const key : program.profile_keys)
+			asm_file << std::format("	dq {:#x}, 0\n", key);
+	}
+
+	// Functions whose address is taken, which are possible targets of `call`. Only first few of them
+	// are counted, since every one of them costs a comparison at each `call`.
+	auto find_call_targets(Generation_Info const& geninfo) -> std::vector<std::pair<std::uint64_t, std::string_view>>
+	{
+		static constexpr unsigned Max_Call_Targets = 8;
+
+		std::set<std::uint64_t> address_taken;
+		auto const scan = [&](std::vector<Operation> const& body) {
+			for (auto const& op : body)
+				if (op.kind == Operation::Kind::Push_Symbol && op.symbol_prefix == Function_Prefix)
+					address_taken.insert(op.ival);
+		};
+		scan(geninfo.main);
+		for (auto const& [name, word] : geninfo.words)
+			if (word.kind == Word::Kind::Function)
+				scan(word.function_body);
+
+		std::vector<std::pair<std::uint64_t, std::string_view>> targets;
+		for (auto const& [name, word] : geninfo.words)
+			if (word.kind == Word::Kind::Function && address_taken.contains(word.id))
+				targets.emplace_back(word.id, name);
+		std::sort(std::begin(targets), std::end(targets));
+		if (targets.size() > Max_Call_Targets)
+			targets.resize(Max_Call_Targets);
+		return targets;
+	}
+
+	// Rough size in bytes of encoded instruction: opcode with prefixes, ModRM and SIB bytes,
+	// and 4 bytes for every immediate or displacement (symbols are always 4 bytes)
+	auto estimated_size(std::string_view instruction) -> unsigned
+	{
+		static constexpr std::string_view Registers[] = {
+			"rax", "rbx", "rcx", "rdx", "rsi", "rdi", "rsp", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15",
+			"eax", "ebx", "ecx", "edx", "esi", "edi", "r8d", "r9d", "r10d", "r11d",
+			"al", "bl", "cl", "dl", "sil", "dil", "r8b", "r9b", "r10b", "r11b",
+		};
+		auto const is_register = [](std::string_view operand) {
+			return std::find(std::cbegin(Registers), std::cend(Registers), operand) != std::cend(Registers);
+		};
+
+		auto const space = instruction.find_first_of(" \t");
+		if (space == std::string_view::npos)
+			return 2;
+		auto const mnemonic = instruction.substr(0, space);
+		auto operands = instruction.substr(space + 1);
+
+		if ((mnemonic == "push" || mnemonic == "pop") && is_register(operands))
+			return operands.starts_with("r") && std::isdigit(operands[1]) ? 2 : 1;
+
+		unsigned size = 3;
+		while (!operands.empty()) {
+			auto const comma = operands.find(',');
+			auto operand = operands.substr(0, comma);
+			operands = comma == std::string_view::npos ? std::string_view{} : operands.substr(comma + 1);
+			while (!operand.empty() && operand.front() == ' ')
+				operand.remove_prefix(1);
+
+			if (is_register(operand))
+				continue;
+			if (auto const memory = operand.find('['); memory != std::string_view::npos) {
+				auto const address = operand.substr(memory + 1, operand.find(']') - memory - 1);
+				size += 1 + 4 * std::any_of(std::cbegin(address), std::cend(address), [](char c) { return c == '_' || c == '+' || c == '-'; });
+				continue;
+			}
+			size += 4;
+		}
+		return size;
+	}
+
+	// Machine outliner used when optimizing for size. Sequences of instructions that repeat in generated code
+	// are moved into shared subroutines and replaced with their calls, when that makes code smaller.
+	// Data stack is the machine stack, so subroutine keeps return address in rbp (which is not used otherwise)
+	// while sequence is executed and puts it back for `ret`, which keeps return predictions balanced.
+	// Sequences do not contain labels, jumps, calls or returns.
+	auto outline_repeated_sequences(std::string const& assembly) -> std::string
+	{
+		static constexpr unsigned Min_Length = 2;
+		static constexpr unsigned Max_Length = 16;
+		static constexpr unsigned Call_Size = 5;
+		static constexpr unsigned Subroutine_Overhead = 3; // pop rbp, push rbp, ret
+
+		std::vector<std::string_view> lines;
+		for (auto rest = std::string_view(assembly); !rest.empty();) {
+			auto const end = rest.find('\n');
+			lines.push_back(rest.substr(0, end));
+			rest = end == std::string_view::npos ? std::string_view{} : rest.substr(end + 1);
+		}
+
+		// Instructions that may be outlined, with index of their line and of sequence of such instructions they belong to
+		struct Instruction
+		{
+			std::string_view text;
+			unsigned line;
+			unsigned run;
+			unsigned size;
+		};
+		std::vector<Instruction> code;
+
+		unsigned run = 0;
+		for (auto i = 0u; i < lines.size(); ++i) {
+			auto text = lines[i].substr(0, lines[i].find(';'));
+			while (!text.empty() && std::isspace(text.back()))
+				text.remove_suffix(1);
+			if (text.empty())
+				continue; // comments do not break sequences
+
+			auto const indented = std::isspace(text.front());
+			while (!text.empty() && std::isspace(text.front()))
+				text.remove_prefix(1);
+			auto const mnemonic = text.substr(0, text.find_first_of(" \t"));
+
+			auto const outlinable = indented && !mnemonic.ends_with(':')
+				&& mnemonic.front() != 'j' && mnemonic != "call" && mnemonic != "ret" && mnemonic != "align"
+				&& mnemonic != "db" && mnemonic != "dq" && !mnemonic.starts_with("res")
+				&& text.find("rbp") == std::string_view::npos;
+			if (!outlinable) {
+				++run;
+				continue;
+			}
+			code.push_back({ text, i, run, estimated_size(text) });
+		}
+
+		struct Candidate
+		{
+			unsigned saving;
+			unsigned length;
+			std::vector<unsigned> starts; // indexes into code
+		};
+		std::vector<Candidate> candidates;
+
+		auto const saving = [](unsigned size, std::size_t count) -> unsigned {
+			auto const outlined = count * Call_Size + size + Subroutine_Overhead;
+			return count * size > outlined ? count * size - outlined : 0;
+		};
+
+		for (auto length = Min_Length; length <= Max_Length; ++length) {
+			std::unordered_map<std::string, std::vector<unsigned>> occurrences;
+			for (auto first = 0u; first + length <= code.size(); ++first) {
+				if (code[first].run != code[first + length - 1].run)
+					continue;
+				std::string key;
+				for (auto k = first; k < first + length; ++k)
+					(key += code[k].text) += '\n';
+				auto &starts = occurrences[std::move(key)];
+				if (starts.empty() || starts.back() + length <= first)
+					starts.push_back(first);
+			}
+
+			for (auto &[key, starts] : occurrences) {
+				if (starts.size() < 2)
+					continue;
+				unsigned size = 0;
+				for (auto k = starts.front(); k < starts.front() + length; ++k)
+					size += code[k].size;
+				if (auto const s = saving(size, starts.size()); s > 0)
+					candidates.push_back({ s, length, std::move(starts) });
+			}
+		}
+
+		// Greedily from the largest saving, sequences that overlap already outlined ones lose those occurrences
+		std::sort(std::begin(candidates), std::end(candidates), [](Candidate const& lhs, Candidate const& rhs) {
+			return std::tie(rhs.saving, rhs.length, lhs.starts) < std::tie(lhs.saving, lhs.length, rhs.starts);
+		});
+
+		std::vector<bool> outlined(code.size(), false);
+		std::unordered_map<unsigned, unsigned> calls; // line -> subroutine replacing sequence starting there
+		std::vector<bool> removed(lines.size(), false);
+		std::ostringstream subroutines;
+		unsigned count = 0;
+
+		for (auto &candidate : candidates) {
+			std::erase_if(candidate.starts, [&](unsigned first) {
+				return std::any_of(std::cbegin(outlined) + first, std::cbegin(outlined) + first + candidate.length, std::identity{});
+			});
+			if (candidate.starts.size() < 2)
+				continue;
+
+			unsigned size = 0;
+			for (auto k = candidate.starts.front(); k < candidate.starts.front() + candidate.length; ++k)
+				size += code[k].size;
+			if (saving(size, candidate.starts.size()) == 0)
+				continue;
+
+			auto const id = count++;
+			subroutines << Outlined_Prefix << id << ":\n";
+			subroutines << "	pop rbp\n";
+			for (auto k = candidate.starts.front(); k < candidate.starts.front() + candidate.length; ++k)
+				subroutines << '\t' << code[k].text << '\n';
+			subroutines << "	push rbp\n";
+			subroutines << "	ret\n";
+
+			for (auto const first : candidate.starts) {
+				auto const last = first + candidate.length - 1;
+				std::fill(std::begin(outlined) + first, std::begin(outlined) + last + 1, true);
+				std::fill(std::begin(removed) + code[first].line, std::begin(removed) + code[last].line + 1, true);
+				calls[code[first].line] = id;
+			}
+			verbose(std::format("Outlined {} instructions repeated {} times", candidate.length, candidate.starts.size()));
+		}
+
+		std::string result;
+		result.reserve(assembly.size());
+		for (auto i = 0u; i < lines.size(); ++i) {
+			if (auto const call = calls.find(i); call != std::end(calls))
+				result += std::format("	call {}{}\n", Outlined_Prefix, call->second);
+			if (!removed[i])
+				(result += lines[i]) += '\n';
+		}
+		if (count > 0) {
+			result += "section .text\n";
+			result += std::move(subroutines).str();
+		}
+		return result;
+	}
+
+	void generate_assembly(Generation_Info &geninfo, fs::path const& asm_path)
+	{
+		std::ofstream output(asm_path, std::ios_base::out | std::ios_base::trunc);
+		if (!output) {
+			error(std::format("Cannot generate ASM file {}", asm_path.c_str()));
+			return;
+		}
+
+		// Whole program is generated first, so that it can be outlined
+		std::ostringstream asm_file;
+
+		asm_header(asm_file, geninfo);
+
+		Program_Context program;
+		program.exiting_functions = find_exiting_functions(geninfo);
+		if (compiler_arguments.profile_generate)
+			program.call_targets = find_call_targets(geninfo);
+
+		auto const layout = function_layout(geninfo);
+		for (auto const* function : layout) {
+			if (auto compiled = compile_register_function(geninfo, function->second)) {
+				verbose(std::format("Function `{}` takes arguments in registers", function->first));
+				program.register_functions.insert({ function->second.id, *std::move(compiled) });
+			}
+		}
+
+		char function_label[sizeof(Function_Body_Prefix) + 20];
+		for (auto const* function : layout) {
+			auto const& [name, def] = *function;
+
+			if (auto const compiled = program.register_functions.find(def.id); compiled != std::end(program.register_functions)) {
+				asm_file << ";; fun " << name << " with arguments in registers\n";
+				asm_file << Function_Register_Prefix << def.id << ":\n";
+				asm_file << compiled->second.body;
+			}
+
+			asm_file << ";; fun " << name << '\n';
+			asm_file << Function_Prefix << def.id << ":\n";
+			asm_file << "	pop rax\n";
+			asm_file << "	mov rbx, [_stacky_callptr]\n";
+			asm_file << "	mov [_stacky_callstack+rbx*8], rax\n";
+			asm_file << "	add qword [_stacky_callptr], 1\n";
+			asm_file << Function_Entry_Prefix << def.id << ":\n";
+
+			std::sprintf(function_label, Function_Body_Prefix "%lu_", def.id);
+			generate_instructions(geninfo, def.function_body, asm_file, program, function_label, name);
+			asm_file << '\n';
+			emit_return(asm_file);
+		}
+
+		asm_file << "global _start\n";
+		asm_file << "_start:\n";
+
+		asm_file << "  pop rax\n";
+		asm_file << "  mov [_stacky_argc], rax\n";
+		asm_file << "  mov [_stacky_argv], rsp\n";
+
+
+		generate_instructions(geninfo, geninfo.main, asm_file, program, Label_Prefix);
+
+		asm_file << R"asm(
+	;; exit syscall
+	mov rax, 60
+	mov rdi, 0
+)asm";
+		if (compiler_arguments.profile_generate)
+			asm_file << "	call _stacky_profile_exit\n";
+		asm_file << "	syscall\n";
+
+		emit_memory_routines(program, asm_file);
+
+		if (auto const cold_code = std::move(program.cold_code).str(); !cold_code.empty()) {
+			asm_file << "section .text.unlikely progbits alloc exec nowrite align=16\n";
+			asm_file << cold_code;
+		}
+
+		if (compiler_arguments.profile_generate)
+			emit_profile_writer(program, asm_file);
+
+		if (compiler_arguments.optimize_size)
+			output << outline_repeated_sequences(std::move(asm_file).str());
+		else
+			output << std::move(asm_file).str();
 	}
 }
 
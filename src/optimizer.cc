@@ -1,9 +1,16 @@
+#include "arguments.hh"
 #include "errors.hh"
 #include "stacky.hh"
+#include "ssa.hh"
+#include "superoptimizer.hh"
+#include "vectorizer.hh"
 
 #include "utilities.cc"
 #include <algorithm>
 #include <iterator>
+#include <map>
+#include <numeric>
+#include <ranges>
 #include <vector>
 #include <utility>
 
@@ -19,6 +26,20 @@ namespace optimizer
 		return result;
 	}
 
+	// Operation of given kind standing in place of `source`, with token renamed to `name` unless it is empty
+	auto make_operation(Operation const& source, Operation::Kind kind, Intrinsic_Kind intrinsic, std::uint64_t ival, std::string_view name = {}) -> Operation
+	{
+		Operation op{};
+		op.kind = kind;
+		op.token = source.token;
+		if (!name.empty())
+			op.token.sval = name;
+		op.ival = ival;
+		op.intrinsic = intrinsic;
+		op.location = source.location;
+		return op;
+	}
+
 	void remove_unused_words_and_strings(
 			Generation_Info &geninfo,
 			std::vector<Operation> const& function_body,
@@ -68,18 +89,109 @@ namespace optimizer
 		return removed_words + removed_strings;
 	}
 
-	auto optimize_comptime_known_conditions([[maybe_unused]] Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	auto reads_memory(Intrinsic_Kind intrinsic) -> bool
 	{
-		bool done_something = false;
+		return intrinsic == Intrinsic_Kind::Load || intrinsic == Intrinsic_Kind::Memory_Compare || intrinsic == Intrinsic_Kind::Memory_Find;
+	}
 
-		auto const remap = [&function_body](unsigned start, unsigned end, unsigned amount, auto const& ...msg)
-		{
-			for (auto& op : function_body)
-				if (op.jump >= start && op.jump <= end) {
-					op.jump -= amount;
+	// Functions are pure when they do not store to memory (also with `memcpy`, `memmove` and `memset`),
+	// make syscalls, generate random numbers or call functions that are not pure. Division is allowed
+	// only by nonzero constant, so that removed call cannot hide a trap. Pure functions may still loop
+	// forever, so those that terminate are marked separately.
+	void infer_purity(Generation_Info &geninfo)
+	{
+		auto const is_pure_operation = [](std::vector<Operation> const& body, unsigned i) {
+			auto const& op = body[i];
+			switch (op.kind) {
+			case Operation::Kind::Call_Symbol:
+				return op.word && op.word->is_pure;
+			case Operation::Kind::Intrinsic:
+				switch (op.intrinsic) {
+				case Intrinsic_Kind::Call:
+				case Intrinsic_Kind::Memory_Copy:
+				case Intrinsic_Kind::Memory_Move:
+				case Intrinsic_Kind::Memory_Set:
+				case Intrinsic_Kind::Random32:
+				case Intrinsic_Kind::Random64:
+				case Intrinsic_Kind::Store:
+				case Intrinsic_Kind::Syscall:
+				case Intrinsic_Kind::Top:
+					return false;
+				case Intrinsic_Kind::Div:
+				case Intrinsic_Kind::Mod:
+				case Intrinsic_Kind::Div_Mod:
+					return i > 0 && body[i-1].kind == Operation::Kind::Push_Int && body[i-1].ival != 0;
+				default:
+					return true;
 				}
+			default:
+				return true;
+			}
 		};
 
+		// Every function starts as pure and loses it until nothing changes, so recursion stays pure
+		for (auto &[name, word] : geninfo.words)
+			word.is_pure = word.kind == Word::Kind::Function;
+
+		for (bool changed = true; changed;) {
+			changed = false;
+			for (auto &[name, word] : geninfo.words) {
+				if (!word.is_pure)
+					continue;
+				for (auto i = 0u; i < word.function_body.size(); ++i) {
+					if (!is_pure_operation(word.function_body, i)) {
+						word.is_pure = false;
+						changed = true;
+						break;
+					}
+				}
+			}
+		}
+
+		for (bool changed = true; changed;) {
+			changed = false;
+			for (auto &[name, word] : geninfo.words) {
+				if (!word.is_pure || word.reads_memory)
+					continue;
+				word.reads_memory = std::any_of(std::cbegin(word.function_body), std::cend(word.function_body), [](Operation const& op) {
+					return (op.kind == Operation::Kind::Intrinsic && reads_memory(op.intrinsic))
+						|| (op.kind == Operation::Kind::Call_Symbol && op.word->reads_memory);
+				});
+				changed |= word.reads_memory;
+			}
+		}
+
+		// Starts from functions without calls and gains callers, so recursion never terminates
+		for (bool changed = true; changed;) {
+			changed = false;
+			for (auto &[name, word] : geninfo.words) {
+				if (!word.is_pure || word.terminates)
+					continue;
+				word.terminates = std::none_of(std::cbegin(word.function_body), std::cend(word.function_body), [](Operation const& op) {
+					return op.kind == Operation::Kind::While
+						|| (op.kind == Operation::Kind::Call_Symbol && !op.word->terminates);
+				});
+				changed |= word.terminates;
+			}
+		}
+	}
+
+	// Erases operations in range [first, last). Jumps past erased range are moved back,
+	// jumps into erased range target first operation after it.
+	void erase_operations(std::vector<Operation> &function_body, unsigned first, unsigned last)
+	{
+		function_body.erase(std::cbegin(function_body) + first, std::cbegin(function_body) + last);
+		for (auto &op : function_body) {
+			if (op.jump == Operation::Empty_Jump || op.jump < first)
+				continue;
+			op.jump = op.jump >= last ? op.jump - (last - first) : first;
+		}
+	}
+
+	auto optimize_comptime_known_conditions([[maybe_unused]] Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		bool done_something = false;
+
 		for (auto branch_op = 1u; branch_op < function_body.size(); ++branch_op) {
 			auto const condition_op = branch_op - 1;
 
@@ -89,68 +201,54 @@ namespace optimizer
 				continue;
 			done_something = true;
 
+			auto const is_true = condition.ival != 0;
+			auto const token = branch.token;
+
 			switch (branch.kind) {
 			case Operation::Kind::Do:
 				{
-					auto const condition_ival = condition.ival;
-					auto const end_op = branch.jump-1;
+					auto const end_op = branch.jump - 1;
+					auto const while_op = function_body[end_op].jump;
+					assert(function_body[end_op].kind == Operation::Kind::End);
+					assert(function_body[while_op].kind == Operation::Kind::While);
 
-					if (condition.ival != 0) {
-						assert(function_body[branch.jump-1].kind == Operation::Kind::End);
-
-						if (std::cbegin(function_body) + branch.jump + 1 != std::cend(function_body)) {
-							warning(function_body[branch.jump].location, "Dead code: Loop is infinite");
-							info(function_body[condition_op-1].location, "Infinite loop introduced here.");
+					if (is_true) {
+						// Single operation after the loop (like `drop`) usually only balances stack effect of function
+						if (end_op + 2 < function_body.size()) {
+							warning(function_body[end_op + 1].location, "Dead code: Loop is infinite");
+							info(function_body[condition_op].location, "Infinite loop introduced here.");
 						}
 
-						function_body.erase(std::cbegin(function_body) + branch.jump, std::end(function_body));
-						function_body.erase(std::cbegin(function_body) + condition_op, std::cbegin(function_body) + branch_op + 1);
-						remap(branch_op+1, end_op, 3);
-						verbose(branch.token, "Optimizing infinite loop (condition is always true)");
+						// `while` stays as a target of `end`, loop is left only by `return`
+						erase_operations(function_body, condition_op, branch_op + 1);
+						verbose(token, "Optimizing infinite loop (condition is always true)");
 					} else {
-						function_body.erase(std::cbegin(function_body) + condition_op, std::cbegin(function_body) + branch.jump);
-						remap(end_op, -1, end_op - branch_op + 3);
-						verbose(branch.token, "Optimizing never executing loop (condition is always false)");
+						// Condition is still evaluated once, only loop body is removed
+						erase_operations(function_body, condition_op, end_op + 1);
+						erase_operations(function_body, while_op, while_op + 1);
+						verbose(token, "Optimizing never executing loop (condition is always false)");
 					}
-
-					// find and remove `while`
-					auto while_op = unsigned(condition_op-1);
-					while (while_op < function_body.size() &&
-							function_body[while_op].kind != Operation::Kind::While && function_body[while_op].jump != branch_op)
-						--while_op;
-					function_body.erase(std::cbegin(function_body) + while_op);
-					if (condition_ival == 0)
-						remap(while_op, branch_op, 1);
 				}
 				break;
 			case Operation::Kind::If:
 				{
-					auto const end_or_else = branch.jump-1;
-					auto const else_op = end_or_else;
-					auto const end = function_body[end_or_else].kind == Operation::Kind::Else ? function_body[end_or_else].jump-1 : end_or_else;
-
-					if (condition.ival != 0) {
-						// Do `if` has else branch? If yes, remove it. Otherwise remove unnesesary end operation
-						if (end != else_op) {
-							function_body.erase(std::cbegin(function_body) + else_op, std::cbegin(function_body) + end + 2);
-							remap(end, -1, end - else_op + 1);
-						} else {
-							function_body.erase(std::cbegin(function_body) + else_op);
-							remap(end, -1, 1);
-						}
-						remap(branch_op, end_or_else, 2); // `if` and condition
-						function_body.erase(std::cbegin(function_body) + condition_op, std::cbegin(function_body) + branch_op + 1);
-						verbose(branch.token, "Optimizing always then `if` (conditions is always true)");
+					auto const has_else = function_body[branch.jump - 1].kind == Operation::Kind::Else;
+					auto const else_op = branch.jump - 1;
+					auto const end_op = has_else ? function_body[else_op].jump : branch.jump;
+					assert(function_body[end_op].kind == Operation::Kind::End);
+
+					if (is_true) {
+						erase_operations(function_body, has_else ? else_op : end_op, end_op + 1);
+						erase_operations(function_body, condition_op, branch_op + 1);
+						verbose(token, "Optimizing always then `if` (conditions is always true)");
 					} else {
-						// Do `if` has else branch? If yes, remove `end` operation from it
-						if (end != else_op) {
-							function_body.erase(std::cbegin(function_body) + end + 1);
+						if (has_else) {
+							erase_operations(function_body, end_op, end_op + 1);
+							erase_operations(function_body, condition_op, else_op + 1);
+						} else {
+							erase_operations(function_body, condition_op, end_op + 1);
 						}
-
-						// remove then branch and condition
-						function_body.erase(std::cbegin(function_body) + condition_op, std::cbegin(function_body) + else_op + 1);
-						remap(end_or_else, -1, 3 + (end_or_else != end));
-						verbose(branch.token, "Optimizing always else `if` (condition is always false)");
+						verbose(token, "Optimizing always else `if` (condition is always false)");
 					}
 				}
 				break;
@@ -158,7 +256,7 @@ namespace optimizer
 				unreachable("We check earlier for possible values");
 			}
 
-			branch_op -= 1;
+			branch_op = condition_op;
 		}
 
 		return done_something;
@@ -262,18 +360,48 @@ namespace optimizer
 					Math(Intrinsic_Kind::Bitwise_And, &)
 					Math(Intrinsic_Kind::Bitwise_Or, |)
 					Math(Intrinsic_Kind::Bitwise_Xor, ^)
-					Math(Intrinsic_Kind::Div, /)
-					Math(Intrinsic_Kind::Greater, >)
-					Math(Intrinsic_Kind::Greater_Eq, >=)
 					Math(Intrinsic_Kind::Left_Shift, <<)
-					Math(Intrinsic_Kind::Less, <)
-					Math(Intrinsic_Kind::Less_Eq, <=)
-					Math(Intrinsic_Kind::Mod, %)
 					Math(Intrinsic_Kind::Mul, *)
 					Math(Intrinsic_Kind::Not_Equal, !=)
 					Math(Intrinsic_Kind::Right_Shift, >>)
 #undef Math
 
+#define Unsigned_Compare(Name, Op) \
+					case Name: \
+						{ \
+							if (stack.size() < 2) switch (finish_constant_folding(i)) { \
+								case Continue: continue; \
+								case Break: return done_something; \
+							} \
+							auto const a = std::uint64_t(stack.back()); stack.pop_back(); \
+							auto const b = std::uint64_t(stack.back()); stack.pop_back(); \
+							stack.push_back(b Op a); \
+						} \
+						break;
+					// Generated code compares as unsigned
+					Unsigned_Compare(Intrinsic_Kind::Greater, >)
+					Unsigned_Compare(Intrinsic_Kind::Greater_Eq, >=)
+					Unsigned_Compare(Intrinsic_Kind::Less, <)
+					Unsigned_Compare(Intrinsic_Kind::Less_Eq, <=)
+#undef Unsigned_Compare
+
+#define Unsigned_Div(Name, Op) \
+					case Name: \
+						{ \
+							if (stack.size() < 2 || stack.back() == 0) switch (finish_constant_folding(i)) { \
+								case Continue: continue; \
+								case Break: return done_something; \
+							} \
+							auto const a = std::uint64_t(stack.back()); stack.pop_back(); \
+							auto const b = std::uint64_t(stack.back()); stack.pop_back(); \
+							stack.push_back(b Op a); \
+						} \
+						break;
+					// Division by zero is left for runtime
+					Unsigned_Div(Intrinsic_Kind::Div, /)
+					Unsigned_Div(Intrinsic_Kind::Mod, %)
+#undef Unsigned_Div
+
 					case Intrinsic_Kind::Drop:
 						{
 							if (stack.size() < 1) switch (finish_constant_folding(i)) {
@@ -311,8 +439,8 @@ namespace optimizer
 								case Continue: continue;
 								case Break: return done_something;
 							}
-							auto const a = stack.back(); stack.pop_back();
-							auto const b = stack.back(); stack.pop_back();
+							auto const a = std::uint64_t(stack.back()); stack.pop_back();
+							auto const b = std::uint64_t(stack.back()); stack.pop_back();
 							stack.push_back(std::max(a, b));
 						}
 						break;
@@ -323,8 +451,8 @@ namespace optimizer
 								case Continue: continue;
 								case Break: return done_something;
 							}
-							auto const a = stack.back(); stack.pop_back();
-							auto const b = stack.back(); stack.pop_back();
+							auto const a = std::uint64_t(stack.back()); stack.pop_back();
+							auto const b = std::uint64_t(stack.back()); stack.pop_back();
 							stack.push_back(std::min(a, b));
 						}
 						break;
@@ -385,6 +513,11 @@ namespace optimizer
 					case Intrinsic_Kind::Boolean_Negate:
 					case Intrinsic_Kind::Load:
 					case Intrinsic_Kind::Store:
+					case Intrinsic_Kind::Memory_Compare:
+					case Intrinsic_Kind::Memory_Copy:
+					case Intrinsic_Kind::Memory_Find:
+					case Intrinsic_Kind::Memory_Move:
+					case Intrinsic_Kind::Memory_Set:
 					case Intrinsic_Kind::Top:
 					case Intrinsic_Kind::Call:
 					case Intrinsic_Kind::Random32:
@@ -404,12 +537,1669 @@ namespace optimizer
 		return done_something;
 	}
 
-	void optimize(Generation_Info &geninfo)
+	// Rewrites `x a + c +` into `x a c + +` (and `x a + c -` into `x a c - +`), where `a` is symbol or integer
+	// and `c` is integer. This way offsets are grouped with their base, ready for constant folding
+	// or hoisting out of loops by backend.
+	auto reassociate_offsets([[maybe_unused]] Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
 	{
-		while (remove_unused_words_and_strings(geninfo)
-			|| for_all_functions(geninfo, optimize_comptime_known_conditions)
-			|| for_all_functions(geninfo, constant_folding))
-		{
+		bool done_something = false;
+
+		auto const is_intrinsic = [&](unsigned i, Intrinsic_Kind kind) {
+			return function_body[i].kind == Operation::Kind::Intrinsic && function_body[i].intrinsic == kind;
+		};
+
+		// Jumps can only target operations after `end` or `else`, so rotating `+ c +` is always safe
+		for (auto i = 1u; i + 2 < function_body.size(); ++i) {
+			auto const& base = function_body[i-1];
+			if (base.kind != Operation::Kind::Push_Symbol && base.kind != Operation::Kind::Push_Int)
+				continue;
+			if (!is_intrinsic(i, Intrinsic_Kind::Add) || function_body[i+1].kind != Operation::Kind::Push_Int)
+				continue;
+			if (!is_intrinsic(i+2, Intrinsic_Kind::Add) && !is_intrinsic(i+2, Intrinsic_Kind::Subtract))
+				continue;
+
+			std::rotate(std::begin(function_body) + i, std::begin(function_body) + i + 1, std::begin(function_body) + i + 3);
+			done_something = true;
+		}
+
+		return done_something;
+	}
+
+	// Inserts operations before position. Jumps to position land on first inserted operation.
+	void insert_operations(std::vector<Operation> &function_body, unsigned position, std::vector<Operation> const& ops)
+	{
+		for (auto &op : function_body)
+			if (op.jump != Operation::Empty_Jump && op.jump > position)
+				op.jump += ops.size();
+		function_body.insert(std::cbegin(function_body) + position, std::cbegin(ops), std::cend(ops));
+	}
+
+	// Replaces operations in range [first, last), which can only be jumped to at first.
+	// Jumps to first land on first replacing operation.
+	void replace_operations(std::vector<Operation> &function_body, unsigned first, unsigned last, std::vector<Operation> const& ops)
+	{
+		for (auto &op : function_body)
+			if (op.jump != Operation::Empty_Jump && op.jump >= last)
+				op.jump = op.jump + ops.size() - (last - first);
+		function_body.erase(std::cbegin(function_body) + first, std::cbegin(function_body) + last);
+		function_body.insert(std::cbegin(function_body) + first, std::cbegin(ops), std::cend(ops));
+	}
+
+	struct Stack_Shuffle
+	{
+		Intrinsic_Kind kind;
+		std::string_view name;
+		unsigned inputs;
+	};
+
+	// Pure stack manipulation intrinsics, cheapest first
+	constexpr Stack_Shuffle Stack_Shuffles[] = {
+		{ Intrinsic_Kind::Drop,     "drop",  1 },
+		{ Intrinsic_Kind::Two_Drop, "2drop", 2 },
+		{ Intrinsic_Kind::Dup,      "dup",   1 },
+		{ Intrinsic_Kind::Over,     "over",  2 },
+		{ Intrinsic_Kind::Two_Dup,  "2dup",  2 },
+		{ Intrinsic_Kind::Two_Over, "2over", 4 },
+		{ Intrinsic_Kind::Swap,     "swap",  2 },
+		{ Intrinsic_Kind::Rot,      "rot",   3 },
+		{ Intrinsic_Kind::Tuck,     "tuck",  2 },
+		{ Intrinsic_Kind::Two_Swap, "2swap", 4 },
+	};
+
+	auto find_stack_shuffle(Intrinsic_Kind kind) -> Stack_Shuffle const*
+	{
+		auto const shuffle = std::find_if(std::cbegin(Stack_Shuffles), std::cend(Stack_Shuffles), [&](auto const& shuffle) {
+			return shuffle.kind == kind;
+		});
+		return shuffle == std::cend(Stack_Shuffles) ? nullptr : shuffle;
+	}
+
+	auto find_stack_shuffle(Operation const& op) -> Stack_Shuffle const*
+	{
+		return op.kind == Operation::Kind::Intrinsic ? find_stack_shuffle(op.intrinsic) : nullptr;
+	}
+
+	// Finds shortest sequence of stack manipulations that transforms `inputs` values into `target`,
+	// using at most `limit` operations. Breadth first search over reachable stack layouts.
+	auto shortest_stack_shuffle(unsigned inputs, std::vector<unsigned> const& target, unsigned limit) -> std::optional<std::vector<Intrinsic_Kind>>
+	{
+		using Layout = std::vector<unsigned>;
+		static std::map<std::pair<Layout, unsigned>, std::optional<std::vector<Intrinsic_Kind>>> cache;
+
+		Layout start(inputs);
+		std::iota(std::begin(start), std::end(start), 0u);
+
+		auto const key = std::pair { target, inputs * 16 + limit };
+		if (auto const cached = cache.find(key); cached != std::end(cache))
+			return cached->second;
+
+		// Layouts larger than that never lead to shorter solution
+		auto const max_size = std::max(unsigned(target.size()), inputs) + 2;
+
+		std::map<Layout, std::pair<Layout, Intrinsic_Kind>> visited;
+		std::vector<Layout> current = { start }, next;
+		visited.insert({ start, {} });
+
+		std::optional<std::vector<Intrinsic_Kind>> result = std::nullopt;
+		for (auto length = 0u; length <= limit && !result; ++length) {
+			for (auto const& layout : current) {
+				if (layout != target)
+					continue;
+
+				std::vector<Intrinsic_Kind> sequence;
+				for (auto it = visited.find(layout); it->first != start; it = visited.find(it->second.first))
+					sequence.push_back(it->second.second);
+				std::reverse(std::begin(sequence), std::end(sequence));
+				result = std::move(sequence);
+				break;
+			}
+
+			for (auto const& layout : current) {
+				for (auto const& shuffle : Stack_Shuffles) {
+					if (layout.size() < shuffle.inputs)
+						continue;
+					auto successor = layout;
+					apply_stack_shuffle(shuffle.kind, successor);
+					if (successor.size() > max_size || visited.contains(successor))
+						continue;
+					visited.insert({ successor, { layout, shuffle.kind } });
+					next.push_back(std::move(successor));
+				}
+			}
+			current = std::exchange(next, {});
+		}
+
+		cache.insert({ key, result });
+		return result;
+	}
+
+	// Replaces runs of stack manipulation intrinsics with the shortest sequence that produces
+	// the same stack layout, removing them completely when they cancel out (`swap swap`, `dup drop`).
+	auto minimize_stack_shuffles([[maybe_unused]] Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		// Longer replacements are not searched, since search space grows exponentially
+		static constexpr unsigned Max_Replacement_Length = 4;
+
+		bool done_something = false;
+
+		// Jumps target only `end`, `while` and operations directly after `end` or `else`,
+		// so only first operation of a run can be jump target
+		for (auto first = 0u; first < function_body.size(); ++first) {
+			auto last = first;
+			unsigned inputs = 0, depth = 0;
+			for (; last < function_body.size(); ++last) {
+				auto const shuffle = find_stack_shuffle(function_body[last]);
+				if (!shuffle)
+					break;
+				if (depth < shuffle->inputs) {
+					inputs += shuffle->inputs - depth;
+					depth = shuffle->inputs;
+				}
+				std::vector<unsigned> probe(depth);
+				apply_stack_shuffle(shuffle->kind, probe);
+				depth = probe.size();
+			}
+
+			if (last - first < 2)
+				continue;
+
+			std::vector<unsigned> target(inputs);
+			std::iota(std::begin(target), std::end(target), 0u);
+			for (auto i = first; i < last; ++i)
+				apply_stack_shuffle(function_body[i].intrinsic, target);
+
+			auto const replacement = shortest_stack_shuffle(inputs, target, std::min(last - first - 1, Max_Replacement_Length));
+			if (!replacement) {
+				first = last;
+				continue;
+			}
+
+			verbose(function_body[first].token, std::format("Replaced {} stack manipulations with {}", last - first, replacement->size()));
+
+			std::vector<Operation> ops;
+			for (auto kind : *replacement)
+				ops.push_back(make_operation(function_body[first], Operation::Kind::Intrinsic, kind, 0, find_stack_shuffle(kind)->name));
+
+			replace_operations(function_body, first, last, ops);
+			done_something = true;
+			first += ops.size();
+		}
+
+		return done_something;
+	}
+
+	// Finds conditions that are constant for every execution using SSA form of function
+	// (values that are constant only after flowing through stack shuffles, branches or loops)
+	// and materializes them as `drop <constant>` right before `if` or `do`,
+	// where `optimize_comptime_known_conditions` can remove the branch.
+	auto propagate_constant_conditions(Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		auto const function = ssa::translate(geninfo, function_body);
+		if (!function)
+			return false;
+
+		auto const constants = ssa::propagate_constants(*function);
+
+		std::vector<std::pair<unsigned, std::uint64_t>> branches;
+		for (auto b = 0u; b < function->blocks.size(); ++b) {
+			auto const& block = function->blocks[b];
+			if (!constants.executable[b] || block.terminator != ssa::Block::Terminator::Branch)
+				continue;
+			if (auto const value = constants.values[block.condition])
+				if (function_body[block.op - 1].kind != Operation::Kind::Push_Int)
+					branches.emplace_back(block.op, *value);
+		}
+
+		// From the back, so earlier positions stay valid
+		std::sort(std::begin(branches), std::end(branches), std::greater<>{});
+		for (auto const& [op, value] : branches) {
+			verbose(function_body[op].token, std::format("Condition is always {}", value != 0));
+			insert_operations(function_body, op, {
+				make_operation(function_body[op], Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0),
+				make_operation(function_body[op], Operation::Kind::Push_Int, {}, value),
+			});
+		}
+
+		return !branches.empty();
+	}
+
+	// Marks operations that can be reached from the start of the function body
+	auto reachable_operations(std::vector<Operation> const& function_body) -> std::vector<bool>
+	{
+		std::vector<bool> reachable(function_body.size() + 1);
+		std::vector<unsigned> pending = { 0 };
+
+		while (!pending.empty()) {
+			auto const i = pending.back();
+			pending.pop_back();
+			if (reachable[i])
+				continue;
+			reachable[i] = true;
+			if (i == function_body.size())
+				continue;
+
+			auto const& op = function_body[i];
+			switch (op.kind) {
+			case Operation::Kind::Return:
+				break;
+			case Operation::Kind::Else:
+			case Operation::Kind::End:
+				pending.push_back(op.jump);
+				break;
+			case Operation::Kind::If:
+			case Operation::Kind::Do:
+				pending.push_back(op.jump);
+				[[fallthrough]];
+			default:
+				pending.push_back(i + 1);
+			}
+		}
+
+		reachable.pop_back();
+		return reachable;
+	}
+
+	// Index of `end` closing `if` or `while` at given position
+	auto matching_end(std::vector<Operation> const& function_body, unsigned i) -> unsigned
+	{
+		auto const& op = function_body[i];
+		if (op.kind == Operation::Kind::If) {
+			auto const& before_jump = function_body[op.jump - 1];
+			return before_jump.kind == Operation::Kind::Else ? before_jump.jump : op.jump;
+		}
+
+		assert(op.kind == Operation::Kind::While);
+		for (auto j = i + 1; j < function_body.size(); ++j)
+			if (function_body[j].kind == Operation::Kind::End && function_body[j].jump == i)
+				return j;
+		unreachable("Every `while` has matching `end`");
+	}
+
+	// Removes code that cannot be executed: operations after `return` and after infinite loops,
+	// together with whole `if` and `while` blocks that start there. `else` and `end` that are
+	// unreachable stay, since they are part of still reachable block.
+	auto remove_unreachable_operations([[maybe_unused]] Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		auto const reachable = reachable_operations(function_body);
+
+		std::vector<std::pair<unsigned, unsigned>> ranges;
+		for (auto first = 0u; first < function_body.size(); ++first) {
+			auto last = first;
+			while (last < function_body.size() && !reachable[last]) {
+				auto const kind = function_body[last].kind;
+				if (kind == Operation::Kind::Else || kind == Operation::Kind::End || kind == Operation::Kind::Do)
+					break;
+				last = kind == Operation::Kind::If || kind == Operation::Kind::While ? matching_end(function_body, last) + 1 : last + 1;
+			}
+
+			if (last > first) {
+				ranges.emplace_back(first, last);
+				first = last;
+			}
+		}
+
+		// From the back, so positions of earlier ranges stay valid
+		for (auto const& [first, last] : ranges | std::views::reverse) {
+			verbose(function_body[first].token, std::format("Removing {} unreachable operations", last - first));
+			erase_operations(function_body, first, last);
+		}
+
+		return !ranges.empty();
+	}
+
+	// Rewrites `if end` and `if else end` into `drop` and `if ... else end` into `if ... end`
+	auto remove_empty_branches([[maybe_unused]] Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		bool done_something = false;
+
+		for (auto i = 0u; i < function_body.size(); ++i) {
+			auto const& op = function_body[i];
+			if (op.kind != Operation::Kind::If)
+				continue;
+
+			auto const end = matching_end(function_body, i);
+			auto const has_else = function_body[op.jump - 1].kind == Operation::Kind::Else;
+			auto const else_op = op.jump - 1;
+
+			if (end == i + 1 || (has_else && else_op == i + 1 && end == i + 2)) {
+				verbose(op.token, "Removing `if` without any code");
+				replace_operations(function_body, i, end + 1, {
+					make_operation(op, Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop"),
+				});
+				done_something = true;
+			} else if (has_else && else_op + 1 == end) {
+				verbose(function_body[else_op].token, "Removing empty `else`");
+				erase_operations(function_body, else_op, else_op + 1);
+				done_something = true;
+			}
+		}
+
+		return done_something;
+	}
+
+	// Rewrites `0 memcpy`, `0 memmove` and `0 memset` into `2drop`, and `0 memcmp` and `0 memchr` into `2drop 0`,
+	// since operations on zero bytes neither touch memory nor find difference or byte
+	auto fold_empty_memory_operations([[maybe_unused]] Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		bool done_something = false;
+
+		for (auto i = 1u; i < function_body.size(); ++i) {
+			auto const& op = function_body[i];
+			auto const& size = function_body[i-1];
+			if (op.kind != Operation::Kind::Intrinsic || size.kind != Operation::Kind::Push_Int || size.ival != 0)
+				continue;
+
+			switch (op.intrinsic) {
+			case Intrinsic_Kind::Memory_Copy:
+			case Intrinsic_Kind::Memory_Move:
+			case Intrinsic_Kind::Memory_Set:
+			case Intrinsic_Kind::Memory_Compare:
+			case Intrinsic_Kind::Memory_Find:
+				break;
+			default:
+				continue;
+			}
+
+			verbose(op.token, std::format("Removing `{}` of zero bytes", op.token.sval));
+			std::vector<Operation> replacement = {
+				make_operation(op, Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop"),
+			};
+			if (op.intrinsic == Intrinsic_Kind::Memory_Compare || op.intrinsic == Intrinsic_Kind::Memory_Find)
+				replacement.push_back(make_operation(op, Operation::Kind::Push_Int, {}, 0));
+			replace_operations(function_body, i - 1, i + 1, replacement);
+			done_something = true;
+		}
+
+		return done_something;
+	}
+
+	// Number of values consumed and produced by operation, when it is known without context
+	auto operation_effect(Operation const& op) -> std::optional<std::pair<unsigned, unsigned>>
+	{
+		switch (op.kind) {
+		case Operation::Kind::Push_Int:
+		case Operation::Kind::Push_Symbol:
+			return std::pair { 0u, 1u };
+		case Operation::Kind::Intrinsic:
+			break;
+		case Operation::Kind::Call_Symbol:
+			if (!op.word || !op.word->has_effect || op.word->is_dynamically_typed)
+				return std::nullopt;
+			return std::pair { unsigned(op.word->effect.input.size()), unsigned(op.word->effect.output.size()) };
+		default:
+			return std::nullopt;
+		}
+
+		if (auto const shuffle = find_stack_shuffle(op)) {
+			std::vector<unsigned> probe(shuffle->inputs);
+			apply_stack_shuffle(op.intrinsic, probe);
+			return std::pair { shuffle->inputs, unsigned(probe.size()) };
+		}
+
+		switch (op.intrinsic) {
+		case Intrinsic_Kind::Top:
+		case Intrinsic_Kind::Call:
+			return std::nullopt;
+		case Intrinsic_Kind::Argc:
+		case Intrinsic_Kind::Argv:
+		case Intrinsic_Kind::Random32:
+		case Intrinsic_Kind::Random64:
+			return std::pair { 0u, 1u };
+		case Intrinsic_Kind::Boolean_Negate:
+		case Intrinsic_Kind::Load:
+			return std::pair { 1u, 1u };
+		case Intrinsic_Kind::Store:
+			return std::pair { 2u, 0u };
+		case Intrinsic_Kind::Memory_Copy:
+		case Intrinsic_Kind::Memory_Move:
+		case Intrinsic_Kind::Memory_Set:
+			return std::pair { 3u, 0u };
+		case Intrinsic_Kind::Memory_Compare:
+		case Intrinsic_Kind::Memory_Find:
+			return std::pair { 3u, 1u };
+		case Intrinsic_Kind::Div_Mod:
+			return std::pair { 2u, 2u };
+		case Intrinsic_Kind::Syscall:
+			return std::pair { unsigned(op.token.sval[7] - '0' + 1), 1u };
+		default:
+			return std::pair { 2u, 1u };
 		}
 	}
+
+	// Operations producing single value without side effects. Division is not included,
+	// since removing it would also remove division by zero error.
+	auto is_pure_value(Operation const& op) -> bool
+	{
+		if (op.kind == Operation::Kind::Push_Int || op.kind == Operation::Kind::Push_Symbol)
+			return true;
+		if (op.kind == Operation::Kind::Call_Symbol) {
+			auto const effect = operation_effect(op);
+			return op.word->is_pure && effect && effect->second == 1;
+		}
+		if (op.kind != Operation::Kind::Intrinsic || find_stack_shuffle(op))
+			return false;
+
+		switch (op.intrinsic) {
+		case Intrinsic_Kind::Top:
+		case Intrinsic_Kind::Call:
+		case Intrinsic_Kind::Random32:
+		case Intrinsic_Kind::Random64:
+		case Intrinsic_Kind::Store:
+		case Intrinsic_Kind::Syscall:
+		case Intrinsic_Kind::Div:
+		case Intrinsic_Kind::Mod:
+		case Intrinsic_Kind::Div_Mod:
+		case Intrinsic_Kind::Memory_Compare:
+		case Intrinsic_Kind::Memory_Copy:
+		case Intrinsic_Kind::Memory_Find:
+		case Intrinsic_Kind::Memory_Move:
+		case Intrinsic_Kind::Memory_Set:
+			return false;
+		default:
+			return true;
+		}
+	}
+
+	// Operations that normalize their result to 0 or 1 are replaced with cheaper ones, when inputs
+	// are already proven to be 0 or 1 in SSA form of function:
+	//   and -> bit-and,  or -> bit-or,  ! -> 1 bit-xor,  0 != | 0 > -> (nothing),  0 = -> 1 bit-xor
+	// Types from type checker are not used, since cast can turn any value into `bool`.
+	// Operations directly before a branch are kept, since they are fused with it.
+	auto remove_boolean_normalization(Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		auto const function = ssa::translate(geninfo, function_body);
+		if (!function)
+			return false;
+
+		auto const booleans = ssa::find_booleans(*function);
+
+		// Operation can be translated more than once, all its instructions have to agree
+		std::map<unsigned, bool, std::greater<>> candidates;
+		for (auto const& instruction : function->values) {
+			if (instruction.kind != ssa::Instruction::Kind::Intrinsic || instruction.op == Operation::Empty_Jump)
+				continue;
+
+			auto const proven = [&]() -> bool {
+				auto const is_zero = [&](unsigned i) {
+					auto const& input = function->values[instruction.inputs[i]];
+					return input.kind == ssa::Instruction::Kind::Constant && input.ival == 0;
+				};
+
+				switch (instruction.intrinsic) {
+				case Intrinsic_Kind::Boolean_And:
+				case Intrinsic_Kind::Boolean_Or:
+					return booleans[instruction.inputs[0]] && booleans[instruction.inputs[1]];
+				case Intrinsic_Kind::Boolean_Negate:
+					return booleans[instruction.inputs[0]];
+				case Intrinsic_Kind::Equal:
+				case Intrinsic_Kind::Not_Equal:
+				case Intrinsic_Kind::Greater:
+					return booleans[instruction.inputs[0]] && is_zero(1);
+				default:
+					return false;
+				}
+			}();
+
+			auto const [it, inserted] = candidates.try_emplace(instruction.op, proven);
+			if (!inserted)
+				it->second = it->second && proven;
+		}
+
+		auto const is_branch = [&](unsigned i) {
+			return i < function_body.size() && (function_body[i].kind == Operation::Kind::If || function_body[i].kind == Operation::Kind::Do
+				|| (function_body[i].kind == Operation::Kind::Intrinsic && function_body[i].intrinsic == Intrinsic_Kind::Boolean_Negate));
+		};
+
+		auto const make_intrinsic = [&](Operation const& op, Intrinsic_Kind intrinsic, std::string_view name) {
+			return make_operation(op, Operation::Kind::Intrinsic, intrinsic, 0, name);
+		};
+		auto const make_one = [&](Operation const& op) {
+			return make_operation(op, Operation::Kind::Push_Int, {}, 1, "1");
+		};
+
+		bool done_something = false;
+
+		// From the back, so earlier positions stay valid
+		for (auto const& [i, proven] : candidates) {
+			if (!proven)
+				continue;
+
+			auto const op = function_body[i];
+			auto const after_zero = i > 0 && function_body[i-1].kind == Operation::Kind::Push_Int && function_body[i-1].ival == 0;
+
+			switch (op.intrinsic) {
+			case Intrinsic_Kind::Boolean_And:
+				function_body[i] = make_intrinsic(op, Intrinsic_Kind::Bitwise_And, "bit-and");
+				break;
+			case Intrinsic_Kind::Boolean_Or:
+				function_body[i] = make_intrinsic(op, Intrinsic_Kind::Bitwise_Or, "bit-or");
+				break;
+			case Intrinsic_Kind::Boolean_Negate:
+				if (is_branch(i + 1))
+					continue;
+				replace_operations(function_body, i, i + 1, { make_one(op), make_intrinsic(op, Intrinsic_Kind::Bitwise_Xor, "bit-xor") });
+				break;
+			case Intrinsic_Kind::Equal:
+				if (!after_zero || is_branch(i + 1))
+					continue;
+				replace_operations(function_body, i - 1, i + 1, { make_one(op), make_intrinsic(op, Intrinsic_Kind::Bitwise_Xor, "bit-xor") });
+				break;
+			case Intrinsic_Kind::Not_Equal:
+			case Intrinsic_Kind::Greater:
+				if (!after_zero)
+					continue;
+				erase_operations(function_body, i - 1, i + 1);
+				break;
+			default:
+				unreachable("only boolean normalizations are candidates");
+			}
+
+			verbose(op.token, "Removing normalization of value that is already boolean");
+			done_something = true;
+		}
+
+		return done_something;
+	}
+
+	// Removes computations whose result is only dropped, like `x 1 + drop` becoming `x drop`.
+	// Value is traced back from `drop` through operations that leave it untouched, within single basic block.
+	auto remove_dead_stack_values([[maybe_unused]] Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		std::vector<bool> is_jump_target;
+		auto const find_jump_targets = [&] {
+			is_jump_target.assign(function_body.size() + 1, false);
+			for (auto const& op : function_body)
+				if (op.jump != Operation::Empty_Jump)
+					is_jump_target[op.jump] = true;
+		};
+		find_jump_targets();
+
+		// Operation that produced value at given depth (1 is top of the stack) before operation `k`
+		auto const find_producer = [&](unsigned k, unsigned depth) -> std::optional<unsigned> {
+			for (auto j = k; j-- > 0 && !is_jump_target[j + 1];) {
+				auto const effect = operation_effect(function_body[j]);
+				if (!effect)
+					return std::nullopt;
+				auto const [inputs, outputs] = *effect;
+				if (depth > outputs) {
+					depth = depth - outputs + inputs;
+					continue;
+				}
+				if (outputs == 1 || (function_body[j].kind == Operation::Kind::Intrinsic && function_body[j].intrinsic == Intrinsic_Kind::Div_Mod && depth == 1))
+					return j;
+				return std::nullopt;
+			}
+			return std::nullopt;
+		};
+
+		auto const make_drops = [&](Operation const& op, unsigned count) {
+			std::vector<Operation> ops;
+			if (count > 0)
+				ops.push_back(count == 2
+					? make_operation(op, Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop")
+					: make_operation(op, Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop"));
+			return ops;
+		};
+
+		bool done_something = false;
+
+		for (auto k = 0u; k < function_body.size(); ++k) {
+			auto const& drop = function_body[k];
+			if (drop.kind != Operation::Kind::Intrinsic || (drop.intrinsic != Intrinsic_Kind::Drop && drop.intrinsic != Intrinsic_Kind::Two_Drop))
+				continue;
+
+			auto const values = drop.intrinsic == Intrinsic_Kind::Drop ? 1u : 2u;
+			for (auto depth = 1u; depth <= values; ++depth) {
+				auto const producer = find_producer(k, depth);
+				if (!producer)
+					continue;
+
+				auto const& op = function_body[*producer];
+				std::vector<Operation> replacement;
+				if (op.kind == Operation::Kind::Intrinsic && op.intrinsic == Intrinsic_Kind::Div_Mod) {
+					// `divmod drop` leaves only remainder
+					replacement.push_back(make_operation(op, Operation::Kind::Intrinsic, Intrinsic_Kind::Mod, 0, "mod"));
+				} else if (is_pure_value(op) && (op.kind != Operation::Kind::Call_Symbol || op.word->terminates)) {
+					replacement = make_drops(op, operation_effect(op)->first);
+				} else {
+					continue;
+				}
+
+				verbose(op.token, "Removing computation of value that is only dropped");
+				replace_operations(function_body, k, k + 1, make_drops(drop, values - 1));
+				replace_operations(function_body, *producer, *producer + 1, replacement);
+				find_jump_targets();
+				done_something = true;
+				k = *producer;
+				break;
+			}
+		}
+
+		return done_something;
+	}
+
+	// Reuses values that are already known within basic block instead of computing them again:
+	//   call of pure function with the same inputs as an earlier call,
+	//   load from address that was loaded from or stored to before.
+	// Values are numbered, so equal numbers mean equal values. Known value is copied with stack
+	// manipulations when it is still on the stack within reach, and loaded constant is pushed directly.
+	// Memory is tracked per address; addresses made of symbol and constant offset are assumed to stay
+	// within their array, so stores to other arrays or other offsets do not forget what is known.
+	// Calls of impure functions and syscalls forget everything about memory.
+	auto reuse_known_values(Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		static constexpr unsigned Max_Window = 6;
+		static constexpr unsigned Max_Replacement_Length = 4;
+
+		std::vector<bool> is_jump_target(function_body.size() + 1, false);
+		for (auto const& op : function_body)
+			if (op.jump != Operation::Empty_Jump)
+				is_jump_target[op.jump] = true;
+
+		struct Address
+		{
+			std::string symbol;
+			std::int64_t offset;
+			auto operator<=>(Address const&) const = default;
+		};
+
+		struct Memory_Value
+		{
+			unsigned address;
+			unsigned size;  // in bytes
+			unsigned value;
+		};
+
+		std::vector<unsigned> stack; // top at the back
+		std::map<std::pair<std::string, std::vector<unsigned>>, unsigned> numbers;
+		std::unordered_map<unsigned, std::uint64_t> constants;
+		std::unordered_map<unsigned, Address> addresses;
+		std::vector<Memory_Value> memory;
+		unsigned next_number = 0, memory_version = 0;
+
+		auto const forget = [&] {
+			stack.clear();
+			numbers.clear();
+			memory.clear();
+		};
+
+		// Values from before the beginning of basic block get new numbers when they are first used
+		auto const reach = [&](unsigned count) {
+			while (stack.size() < count)
+				stack.insert(std::begin(stack), next_number++);
+		};
+
+		auto const number = [&](std::string key, std::vector<unsigned> inputs) {
+			auto const [it, inserted] = numbers.try_emplace({ std::move(key), std::move(inputs) }, next_number);
+			next_number += inserted;
+			return it->second;
+		};
+
+		auto const constant = [&](std::uint64_t value) {
+			auto const n = number(std::to_string(value), {});
+			constants[n] = value;
+			return n;
+		};
+
+		auto const same_address = [&](unsigned lhs, unsigned rhs) {
+			auto const a = addresses.find(lhs), b = addresses.find(rhs);
+			return lhs == rhs || (a != std::cend(addresses) && b != std::cend(addresses) && a->second == b->second);
+		};
+
+		auto const may_alias = [&](Memory_Value const& known, unsigned address, unsigned size) {
+			auto const a = addresses.find(known.address), b = addresses.find(address);
+			if (a == std::cend(addresses) || b == std::cend(addresses))
+				return true;
+			return a->second.symbol == b->second.symbol
+				&& a->second.offset < b->second.offset + std::int64_t(size)
+				&& b->second.offset < a->second.offset + std::int64_t(known.size);
+		};
+
+		auto const access_size = [](Operation const& op) -> unsigned {
+			switch (op.token.sval[op.intrinsic == Intrinsic_Kind::Load ? 4 : 5]) {
+			case '8': return 1;
+			case '1': return 2;
+			case '3': return 4;
+			default:  return 8;
+			}
+		};
+
+		// Replaces operation at `i` consuming `count` values with copy of the `value` from the stack
+		auto const replace_with_copy = [&](unsigned i, unsigned count, unsigned value) -> std::optional<std::vector<Operation>> {
+			auto const copy = std::find(std::crbegin(stack), std::crend(stack), value);
+			auto const window = unsigned(copy - std::crbegin(stack)) + 1 + count;
+			if (copy == std::crend(stack) || window > Max_Window)
+				return std::nullopt;
+
+			std::vector<unsigned> target(window - count);
+			std::iota(std::begin(target), std::end(target), 0u);
+			target.push_back(0);
+
+			auto const replacement = shortest_stack_shuffle(window, target, Max_Replacement_Length);
+			if (!replacement)
+				return std::nullopt;
+
+			std::vector<Operation> ops;
+			for (auto kind : *replacement)
+				ops.push_back(make_operation(function_body[i], Operation::Kind::Intrinsic, kind, 0, find_stack_shuffle(kind)->name));
+			return ops;
+		};
+
+		bool done_something = false;
+
+		auto const replace = [&](unsigned &i, std::vector<Operation> const& ops, unsigned value, std::string_view message) {
+			verbose(function_body[i].token, message);
+			replace_operations(function_body, i, i + 1, ops);
+			is_jump_target.insert(std::begin(is_jump_target) + i + 1, ops.size() - 1, false);
+			stack.push_back(value);
+			i += ops.size() - 1;
+			done_something = true;
+		};
+
+		for (auto i = 0u; i < function_body.size(); ++i) {
+			auto const& op = function_body[i];
+			if (is_jump_target[i])
+				forget();
+
+			auto const effect = op.kind == Operation::Kind::Call_Symbol ? ssa::call_effect(geninfo, op) : operation_effect(op);
+			if (!effect) {
+				if (op.kind != Operation::Kind::Cast) {
+					forget();
+					++memory_version;
+				}
+				continue;
+			}
+			auto const [count, outputs] = *effect;
+
+			reach(count);
+			if (find_stack_shuffle(op)) {
+				apply_stack_shuffle(op.intrinsic, stack);
+				continue;
+			}
+			std::vector<unsigned> inputs(std::cend(stack) - count, std::cend(stack));
+			stack.resize(stack.size() - count);
+
+			switch (op.kind) {
+			case Operation::Kind::Push_Int:
+				stack.push_back(constant(op.ival));
+				continue;
+
+			case Operation::Kind::Push_Symbol:
+				{
+					auto key = std::format("{}{}", op.symbol_prefix, op.ival);
+					auto const n = number(key, {});
+					addresses[n] = { std::move(key), 0 };
+					stack.push_back(n);
+				}
+				continue;
+
+			case Operation::Kind::Call_Symbol:
+				if (!is_pure_value(op)) {
+					if (!op.word->is_pure) {
+						memory.clear();
+						++memory_version;
+					}
+					for (auto n = 0u; n < outputs; ++n)
+						stack.push_back(next_number++);
+					continue;
+				}
+				{
+					auto key = std::format("call {}", op.ival);
+					if (op.word->reads_memory)
+						key += std::format(" @{}", memory_version);
+
+					if (auto const known = numbers.find({ key, inputs }); known != std::cend(numbers)) {
+						if (auto const ops = replace_with_copy(i, count, known->second)) {
+							replace(i, *ops, known->second, "Reusing result of earlier call of pure function");
+							continue;
+						}
+					}
+					stack.push_back(number(std::move(key), std::move(inputs)));
+				}
+				continue;
+
+			default:
+				break;
+			}
+
+			switch (op.intrinsic) {
+			case Intrinsic_Kind::Load:
+				{
+					auto const size = access_size(op);
+					auto const known = std::find_if(std::crbegin(memory), std::crend(memory), [&](Memory_Value const& value) {
+						return value.size == size && same_address(value.address, inputs[0]);
+					});
+
+					if (known == std::crend(memory)) {
+						memory.push_back({ inputs[0], size, next_number });
+						stack.push_back(next_number++);
+						continue;
+					}
+
+					auto const value = known->value;
+					if (auto const ops = replace_with_copy(i, count, value)) {
+						replace(i, *ops, value, "Reusing value loaded from or stored to the same address");
+					} else if (auto const c = constants.find(value); c != std::cend(constants)) {
+						std::vector<Operation> ops = {
+							make_operation(op, Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop"),
+							make_operation(op, Operation::Kind::Push_Int, {}, c->second),
+						};
+						replace(i, ops, value, "Forwarding constant stored to the same address");
+					} else {
+						stack.push_back(value);
+					}
+				}
+				continue;
+
+			case Intrinsic_Kind::Store:
+				{
+					auto const size = access_size(op);
+					std::erase_if(memory, [&](Memory_Value const& known) { return may_alias(known, inputs[0], size); });
+					++memory_version;
+
+					// Narrow store keeps only low bytes of the value, which are known only for constants
+					auto value = std::optional<unsigned>(inputs[1]);
+					if (size < 8) {
+						auto const c = constants.find(inputs[1]);
+						value = c == std::cend(constants) ? std::nullopt : std::optional(constant(c->second & ((std::uint64_t(1) << (8 * size)) - 1)));
+					}
+					if (value)
+						memory.push_back({ inputs[0], size, *value });
+				}
+				continue;
+
+			case Intrinsic_Kind::Syscall:
+			case Intrinsic_Kind::Memory_Copy:
+			case Intrinsic_Kind::Memory_Move:
+			case Intrinsic_Kind::Memory_Set:
+				memory.clear();
+				++memory_version;
+				for (auto n = 0u; n < outputs; ++n)
+					stack.push_back(next_number++);
+				continue;
+
+			// Results of scans are reused like those of pure functions reading memory
+			case Intrinsic_Kind::Memory_Compare:
+			case Intrinsic_Kind::Memory_Find:
+				{
+					auto key = std::format("intrinsic {} @{}", int(op.intrinsic), memory_version);
+					if (auto const known = numbers.find({ key, inputs }); known != std::cend(numbers)) {
+						if (auto const ops = replace_with_copy(i, count, known->second)) {
+							replace(i, *ops, known->second, "Reusing result of earlier scan of the same memory");
+							continue;
+						}
+					}
+					stack.push_back(number(std::move(key), std::move(inputs)));
+				}
+				continue;
+
+			default:
+				break;
+			}
+
+			if (!is_pure_value(op)) {
+				for (auto n = 0u; n < outputs; ++n)
+					stack.push_back(next_number++);
+				continue;
+			}
+
+			// Addresses with constant offset from symbol are tracked through addition and subtraction
+			auto const is_offset = op.intrinsic == Intrinsic_Kind::Add || op.intrinsic == Intrinsic_Kind::Subtract;
+			std::optional<Address> address = std::nullopt;
+			if (is_offset && addresses.contains(inputs[0]) && constants.contains(inputs[1])) {
+				auto const offset = std::int64_t(constants[inputs[1]]);
+				address = addresses[inputs[0]];
+				address->offset += op.intrinsic == Intrinsic_Kind::Add ? offset : -offset;
+			} else if (op.intrinsic == Intrinsic_Kind::Add && addresses.contains(inputs[1]) && constants.contains(inputs[0])) {
+				address = addresses[inputs[1]];
+				address->offset += std::int64_t(constants[inputs[0]]);
+			}
+
+			switch (op.intrinsic) {
+			case Intrinsic_Kind::Add:
+			case Intrinsic_Kind::Mul:
+			case Intrinsic_Kind::Bitwise_And:
+			case Intrinsic_Kind::Bitwise_Or:
+			case Intrinsic_Kind::Bitwise_Xor:
+			case Intrinsic_Kind::Boolean_And:
+			case Intrinsic_Kind::Boolean_Or:
+			case Intrinsic_Kind::Equal:
+			case Intrinsic_Kind::Not_Equal:
+			case Intrinsic_Kind::Min:
+			case Intrinsic_Kind::Max:
+				std::sort(std::begin(inputs), std::end(inputs));
+				break;
+			default:
+				break;
+			}
+
+			auto const n = address ? number(std::format("{}{:+}", address->symbol, address->offset), {}) : number(std::format("intrinsic {}", int(op.intrinsic)), std::move(inputs));
+			if (address)
+				addresses[n] = *address;
+			stack.push_back(n);
+		}
+
+		return done_something;
+	}
+
+	// Follows values through operations in range [first, last), where each value on the stack is
+	// represented by a tag. Stack manipulations move tags, computed values get tag 0 and values
+	// that differ between branches are merged into 0. Fails for unknown stack effects and `return`.
+	auto track_stack_values(Generation_Info const& geninfo, std::vector<Operation> const& body, unsigned first, unsigned last, std::vector<unsigned> &stack) -> bool
+	{
+		auto const merge = [](std::vector<unsigned> &into, std::vector<unsigned> const& other) {
+			if (into.size() != other.size())
+				return false;
+			for (auto i = 0u; i < into.size(); ++i)
+				if (into[i] != other[i])
+					into[i] = 0;
+			return true;
+		};
+
+		auto const pop_condition = [&] {
+			if (stack.empty())
+				return false;
+			stack.pop_back();
+			return true;
+		};
+
+		for (auto i = first; i < last; ++i) {
+			auto const& op = body[i];
+			switch (op.kind) {
+			case Operation::Kind::Cast:
+				continue;
+
+			case Operation::Kind::If:
+				{
+					if (!pop_condition())
+						return false;
+					auto const has_else = body[op.jump - 1].kind == Operation::Kind::Else;
+					auto const end = matching_end(body, i);
+					auto otherwise = stack;
+					if (!track_stack_values(geninfo, body, i + 1, has_else ? op.jump - 1 : end, stack))
+						return false;
+					if (has_else && !track_stack_values(geninfo, body, op.jump, end, otherwise))
+						return false;
+					if (!merge(stack, otherwise))
+						return false;
+					i = end;
+				}
+				continue;
+
+			case Operation::Kind::While:
+				{
+					auto const end = matching_end(body, i);
+					auto condition_end = i + 1;
+					while (condition_end < end && !(body[condition_end].kind == Operation::Kind::Do && body[condition_end].jump == end + 1))
+						++condition_end;
+					if (condition_end == end)
+						return false;
+
+					// Iterate until tags at the beginning of the loop stop changing
+					for (auto head = stack;;) {
+						auto state = head;
+						std::swap(stack, state);
+						if (!track_stack_values(geninfo, body, i + 1, condition_end, stack) || !pop_condition())
+							return false;
+						auto const after_condition = stack;
+						if (!track_stack_values(geninfo, body, condition_end + 1, end, stack))
+							return false;
+						auto merged = head;
+						if (!merge(merged, stack))
+							return false;
+						if (merged == head) {
+							stack = after_condition;
+							break;
+						}
+						head = std::move(merged);
+					}
+					i = end;
+				}
+				continue;
+
+			case Operation::Kind::Call_Symbol:
+			case Operation::Kind::Push_Int:
+			case Operation::Kind::Push_Symbol:
+			case Operation::Kind::Intrinsic:
+				{
+					auto const effect = op.kind == Operation::Kind::Call_Symbol ? ssa::call_effect(geninfo, op) : operation_effect(op);
+					if (!effect || stack.size() < effect->first)
+						return false;
+					if (find_stack_shuffle(op)) {
+						apply_stack_shuffle(op.intrinsic, stack);
+					} else {
+						stack.resize(stack.size() - effect->first);
+						stack.resize(stack.size() + effect->second, 0);
+					}
+				}
+				continue;
+
+			default:
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Unrolls loops counting up to a bound that does not change inside the loop:
+	//   while dup N <|!= do B C + end    (N is integer or symbol)
+	//   while 2dup  >|!= do B C + end    (bound lies below counter)
+	// where B does not modify counter or bound. Loop is replaced with the one executing
+	// B C + several times per iteration, while enough iterations remain, and followed by
+	// the original loop that handles remaining iterations.
+	auto unroll_counted_loops(Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		// Larger bodies do not benefit from less frequent branching
+		static constexpr unsigned Max_Body_Length = 32;
+		static constexpr std::uint64_t Min_Profiled_Iterations = 64;
+
+		// Stack below values that are tracked, body may use them freely
+		static constexpr unsigned Stack_Padding = 16;
+		enum Tag : unsigned { Unknown, Counter, Bound };
+
+		auto const factor = compiler_arguments.unroll_factor;
+		if (factor < 2)
+			return false;
+
+		auto const is_intrinsic = [&](unsigned i, Intrinsic_Kind kind) {
+			return i < function_body.size() && function_body[i].kind == Operation::Kind::Intrinsic && function_body[i].intrinsic == kind;
+		};
+
+		bool done_something = false;
+
+		// From the back, so loops created here are never visited and earlier positions stay valid
+		for (auto w = function_body.size(); w-- > 0;) {
+			if (function_body[w].kind != Operation::Kind::While)
+				continue;
+
+			// Recognize condition
+			auto const bound_on_stack = is_intrinsic(w + 1, Intrinsic_Kind::Two_Dup);
+			auto const compare = bound_on_stack ? w + 2 : w + 3;
+			if (!bound_on_stack && !(is_intrinsic(w + 1, Intrinsic_Kind::Dup) && w + 2 < function_body.size()
+					&& (function_body[w + 2].kind == Operation::Kind::Push_Int || function_body[w + 2].kind == Operation::Kind::Push_Symbol)))
+				continue;
+			auto const is_less = is_intrinsic(compare, bound_on_stack ? Intrinsic_Kind::Greater : Intrinsic_Kind::Less);
+			if (!is_less && !is_intrinsic(compare, Intrinsic_Kind::Not_Equal))
+				continue;
+			auto const do_op = compare + 1;
+			if (do_op >= function_body.size() || function_body[do_op].kind != Operation::Kind::Do)
+				continue;
+
+			// Loops rarely iterated according to the profile are not worth larger code
+			if (auto const iterations = geninfo.profile.count(function_body[do_op].location, Profile_Counter::Loop_Body); iterations && *iterations < Min_Profiled_Iterations)
+				continue;
+
+			// Loops over arrays that backend processes several elements at once are left to it
+			if (vectorizer::recognize_idiom(function_body, w)) {
+				verbose(function_body[w].token, "Not unrolling loop that will be replaced with idiom");
+				continue;
+			}
+			if (vectorizer::analyze(function_body, w)) {
+				verbose(function_body[w].token, "Not unrolling loop that will be vectorized");
+				continue;
+			}
+
+			// Recognize increment at the end of the body
+			auto const end = function_body[do_op].jump - 1;
+			assert(function_body[end].kind == Operation::Kind::End && function_body[end].jump == w);
+			if (end - do_op - 1 > Max_Body_Length || end < do_op + 3)
+				continue;
+			auto const& step = function_body[end - 2];
+			if (step.kind != Operation::Kind::Push_Int || step.ival == 0 || step.ival >= (1ull << 32) || !is_intrinsic(end - 1, Intrinsic_Kind::Add))
+				continue;
+
+			// Body must leave counter and bound where they were
+			std::vector<unsigned> stack(Stack_Padding, Unknown);
+			if (bound_on_stack)
+				stack.push_back(Bound);
+			stack.push_back(Counter);
+			auto const expected = stack;
+			if (!track_stack_values(geninfo, function_body, do_op + 1, end - 2, stack) || stack != expected)
+				continue;
+
+			// Guard ensures that `factor` iterations remain, so that checks in between can be skipped
+			auto const& dup = function_body[w + 1];
+			std::vector<Operation> ops;
+			auto const intrinsic = [&](Intrinsic_Kind kind, std::string_view name) {
+				ops.push_back(make_operation(dup, Operation::Kind::Intrinsic, kind, 0, name));
+			};
+			auto const integer = [&](std::uint64_t value) {
+				ops.push_back(make_operation(dup, Operation::Kind::Push_Int, {}, value, "unroll"));
+			};
+
+			ops.push_back(function_body[w]);
+			if (is_less) {
+				// bound - min(counter, bound) > (factor - 1) * step
+				if (bound_on_stack) {
+					intrinsic(Intrinsic_Kind::Two_Dup, "2dup");
+					intrinsic(Intrinsic_Kind::Over,    "over");
+					intrinsic(Intrinsic_Kind::Swap,    "swap");
+					intrinsic(Intrinsic_Kind::Min,     "min");
+				} else {
+					intrinsic(Intrinsic_Kind::Dup, "dup");
+					ops.push_back(function_body[w + 2]);
+					intrinsic(Intrinsic_Kind::Min, "min");
+					ops.push_back(function_body[w + 2]);
+					intrinsic(Intrinsic_Kind::Swap, "swap");
+				}
+				intrinsic(Intrinsic_Kind::Subtract, "-");
+				integer((factor - 1) * step.ival);
+			} else {
+				// Counter reaches bound exactly, so bound - counter >= factor * step
+				if (bound_on_stack) {
+					intrinsic(Intrinsic_Kind::Two_Dup, "2dup");
+				} else {
+					ops.push_back(function_body[w + 2]);
+					intrinsic(Intrinsic_Kind::Over, "over");
+				}
+				intrinsic(Intrinsic_Kind::Subtract, "-");
+				integer(factor * step.ival - 1);
+			}
+			intrinsic(Intrinsic_Kind::Greater, ">");
+
+			auto const unrolled_do = ops.size();
+			ops.push_back(function_body[do_op]);
+			for (auto copy = 0u; copy < factor; ++copy) {
+				// Jumps inside body stay inside body
+				auto const start = w + ops.size();
+				for (auto i = do_op + 1; i < end; ++i) {
+					ops.push_back(function_body[i]);
+					if (ops.back().jump != Operation::Empty_Jump)
+						ops.back().jump = ops.back().jump - (do_op + 1) + start;
+				}
+			}
+			ops.push_back(function_body[end]);
+			ops.back().jump = w;
+			ops[unrolled_do].jump = w + ops.size();
+
+			verbose(function_body[w].token, std::format("Unrolling loop {} times", factor));
+			insert_operations(function_body, w, ops);
+			function_body[end + ops.size()].jump = w + ops.size();
+			done_something = true;
+		}
+
+		return done_something;
+	}
+
+	// Rewrites sequences into cheaper equivalents found by `stacky superopt`
+	auto apply_superoptimizer_rules([[maybe_unused]] Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		auto const matches = [](Operation const& op, superoptimizer::Rule_Operation const& expected) {
+			if (op.kind != expected.kind)
+				return false;
+			switch (op.kind) {
+			case Operation::Kind::Intrinsic: return op.intrinsic == expected.intrinsic;
+			case Operation::Kind::Push_Int:  return op.ival == expected.ival;
+			default:                         return false;
+			}
+		};
+
+		using Key = std::pair<Operation::Kind, std::uint64_t>;
+		auto const key = [](auto const& op) {
+			return Key { op.kind, op.kind == Operation::Kind::Intrinsic ? std::uint64_t(op.intrinsic) : op.ival };
+		};
+
+		// Rules grouped by their first operation
+		static auto const rules_by_first = [&] {
+			std::map<Key, std::vector<superoptimizer::Rule const*>> rules;
+			for (auto const& rule : superoptimizer::rules)
+				rules[key(rule.pattern.operations[0])].push_back(&rule);
+			return rules;
+		}();
+
+		bool done_something = false;
+
+		// Patterns consist only of intrinsics and integers, so only their first operation can be jump target
+		for (auto i = 0u; i < function_body.size(); ++i) {
+			if (function_body[i].kind != Operation::Kind::Intrinsic && function_body[i].kind != Operation::Kind::Push_Int)
+				continue;
+
+			auto const candidates = rules_by_first.find(key(function_body[i]));
+			if (candidates == std::end(rules_by_first))
+				continue;
+
+			for (auto const* rule_pointer : candidates->second) {
+				auto const& rule = *rule_pointer;
+				if (i + rule.pattern.length > function_body.size())
+					continue;
+				if (!std::equal(std::cbegin(rule.pattern), std::cend(rule.pattern), std::cbegin(function_body) + i, [&](auto const& expected, auto const& op) { return matches(op, expected); }))
+					continue;
+
+				verbose(function_body[i].token, std::format("Rewriting sequence of {} operations into {}", rule.pattern.length, rule.replacement.length));
+
+				std::vector<Operation> ops;
+				for (auto const& replacement : rule.replacement)
+					ops.push_back(make_operation(function_body[i], replacement.kind, replacement.intrinsic, replacement.ival, replacement.name));
+				replace_operations(function_body, i, i + rule.pattern.length, ops);
+				done_something = true;
+				break;
+			}
+		}
+
+		return done_something;
+	}
+
+	// Direct call of function with given id, standing for `call` intrinsic at the same place
+	auto direct_call(Generation_Info &geninfo, std::uint64_t id, Operation const& call) -> std::optional<Operation>
+	{
+		auto const callee = std::find_if(std::begin(geninfo.words), std::end(geninfo.words), [&](auto const& entry) {
+			return entry.second.kind == Word::Kind::Function && entry.second.id == id;
+		});
+		if (callee == std::end(geninfo.words))
+			return std::nullopt;
+
+		auto op = make_operation(call, Operation::Kind::Call_Symbol, {}, id);
+		op.sval = callee->first;
+		op.word = &callee->second;
+		op.symbol_prefix = Function_Prefix;
+		return op;
+	}
+
+	// Operations in range (push, call) of function address that is only moved by stack manipulations
+	// before it is called, with the address removed from them. Nothing when address is copied, consumed
+	// by other operation or stack manipulation without it has no short equivalent.
+	auto without_function_address(Generation_Info const& geninfo, std::vector<Operation> const& function_body, unsigned push, unsigned call) -> std::optional<std::vector<Operation>>
+	{
+		std::vector<Operation> ops;
+		std::vector<unsigned> stack = { 1 }; // 1 for the address, values below are not it
+		auto const reach = [&](unsigned count) {
+			if (stack.size() < count)
+				stack.insert(std::begin(stack), count - stack.size(), 0);
+		};
+
+		for (auto k = push + 1; k < call; ++k) {
+			auto const& op = function_body[k];
+			if (op.jump != Operation::Empty_Jump)
+				return std::nullopt;
+
+			if (op.kind == Operation::Kind::Cast) {
+				if (!stack.empty() && stack.back() == 1)
+					return std::nullopt;
+				ops.push_back(op);
+				continue;
+			}
+
+			if (auto const shuffle = find_stack_shuffle(op)) {
+				reach(shuffle->inputs);
+				auto const inputs = std::cend(stack) - shuffle->inputs;
+				auto const address = std::find(inputs, std::cend(stack), 1u);
+				if (address == std::cend(stack)) {
+					apply_stack_shuffle(op.intrinsic, stack);
+					ops.push_back(op);
+					continue;
+				}
+
+				// Layout produced by the same stack manipulation from inputs without the address
+				auto const removed = unsigned(address - inputs);
+				std::vector<unsigned> layout(shuffle->inputs);
+				std::iota(std::begin(layout), std::end(layout), 0u);
+				apply_stack_shuffle(op.intrinsic, layout);
+				if (std::count(std::cbegin(layout), std::cend(layout), removed) != 1)
+					return std::nullopt;
+				std::erase(layout, removed);
+				for (auto &value : layout)
+					value -= value > removed;
+
+				auto const replacement = shortest_stack_shuffle(shuffle->inputs - 1, layout, 1);
+				if (!replacement)
+					return std::nullopt;
+				for (auto kind : *replacement)
+					ops.push_back(make_operation(op, Operation::Kind::Intrinsic, kind, 0, find_stack_shuffle(kind)->name));
+				apply_stack_shuffle(op.intrinsic, stack);
+				continue;
+			}
+
+			auto const effect = op.kind == Operation::Kind::Call_Symbol ? ssa::call_effect(geninfo, op) : operation_effect(op);
+			if (!effect)
+				return std::nullopt;
+			reach(effect->first);
+			if (std::find(std::cend(stack) - effect->first, std::cend(stack), 1u) != std::cend(stack))
+				return std::nullopt;
+			stack.resize(stack.size() - effect->first);
+			stack.resize(stack.size() + effect->second, 0);
+			ops.push_back(op);
+		}
+
+		if (std::count(std::cbegin(stack), std::cend(stack), 1u) != 1 || stack.back() != 1)
+			return std::nullopt;
+		return ops;
+	}
+
+	// Replaces `call` of function address that is known inside basic block, like `&f ... call`
+	// or `&fun ... end call`, with direct call. Values are followed by tags like in `track_stack_values`,
+	// where tag is index of `&f` plus one and values below tracked ones are unknown.
+	auto devirtualize_calls(Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		std::vector<bool> is_jump_target(function_body.size() + 1, false);
+		for (auto const& op : function_body)
+			if (op.jump != Operation::Empty_Jump)
+				is_jump_target[op.jump] = true;
+
+		std::vector<std::pair<unsigned, unsigned>> calls; // `call` and `&f` that it calls
+		std::vector<unsigned> stack;
+		auto const consume = [&](unsigned count) {
+			stack.erase(std::end(stack) - std::min<std::size_t>(count, stack.size()), std::end(stack));
+		};
+
+		for (auto i = 0u; i < function_body.size(); ++i) {
+			if (is_jump_target[i])
+				stack.clear();
+
+			auto const& op = function_body[i];
+			switch (op.kind) {
+			case Operation::Kind::Cast:
+			case Operation::Kind::While:
+				continue;
+			case Operation::Kind::If:
+			case Operation::Kind::Do:
+				consume(1);
+				continue;
+			case Operation::Kind::Push_Symbol:
+				stack.push_back(op.symbol_prefix == Function_Prefix ? i + 1 : 0);
+				continue;
+			case Operation::Kind::Intrinsic:
+				if (op.intrinsic == Intrinsic_Kind::Call && !stack.empty() && stack.back() != 0)
+					calls.emplace_back(i, stack.back() - 1);
+				break;
+			default:
+				break;
+			}
+
+			if (auto const shuffle = find_stack_shuffle(op)) {
+				if (stack.size() < shuffle->inputs)
+					stack.insert(std::begin(stack), shuffle->inputs - stack.size(), 0);
+				apply_stack_shuffle(op.intrinsic, stack);
+				continue;
+			}
+
+			auto const effect = op.kind == Operation::Kind::Call_Symbol ? ssa::call_effect(geninfo, op) : operation_effect(op);
+			if (!effect) {
+				stack.clear();
+				continue;
+			}
+			consume(effect->first);
+			stack.resize(stack.size() + effect->second, 0);
+		}
+
+		bool done_something = false;
+		// From the back, so earlier positions stay valid. Since `call` forgets everything
+		// that is known about the stack, ranges from address to its call do not overlap.
+		for (auto const& [i, address] : calls | std::views::reverse) {
+			auto const call = direct_call(geninfo, function_body[address].ival, function_body[i]);
+			if (!call)
+				continue;
+
+			verbose(function_body[i].token, std::format("Call of `{}` through pointer is direct", call->sval));
+
+			// Address that is only moved around is not needed anymore
+			if (auto ops = without_function_address(geninfo, function_body, address, i)) {
+				ops->push_back(*call);
+				replace_operations(function_body, address, i + 1, *ops);
+			} else {
+				auto const drop = make_operation(function_body[i], Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop");
+				replace_operations(function_body, i, i + 1, { drop, *call });
+			}
+			done_something = true;
+		}
+		return done_something;
+	}
+
+	// Replaces `call` whose target was almost always the same function according to profile with
+	// `dup &f = if drop f else call end`, so that common case is direct call.
+	auto speculate_call_targets(Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		static constexpr std::uint64_t Min_Profiled_Calls = 16;
+
+		bool done_something = false;
+		// From the back, so earlier positions stay valid
+		for (auto i = unsigned(function_body.size()); i-- > 0;) {
+			auto const& op = function_body[i];
+			if (op.kind != Operation::Kind::Intrinsic || op.intrinsic != Intrinsic_Kind::Call)
+				continue;
+
+			std::uint64_t total = 0, dominant = 0, target = 0;
+			for (auto const& [name, word] : geninfo.words) {
+				if (word.kind != Word::Kind::Function)
+					continue;
+				auto const count = geninfo.profile.count(op.location, Profile_Counter::Call_Target, name).value_or(0);
+				total += count;
+				if (count > dominant)
+					dominant = count, target = word.id;
+			}
+			// Dominant target takes at least 90% of calls
+			if (total < Min_Profiled_Calls || dominant * 10 < total * 9)
+				continue;
+
+			auto const call = direct_call(geninfo, target, op);
+			if (!call)
+				continue;
+
+			verbose(op.token, std::format("Call through pointer is guarded direct call of `{}` for {}% of calls", call->sval, dominant * 100 / total));
+			auto const intrinsic = [&](Intrinsic_Kind kind) {
+				return make_operation(op, Operation::Kind::Intrinsic, kind, 0);
+			};
+			auto const branch = [&](Operation::Kind kind, unsigned jump) {
+				auto branch = make_operation(op, kind, {}, 0);
+				branch.jump = jump;
+				return branch;
+			};
+			auto address = make_operation(op, Operation::Kind::Push_Symbol, {}, target);
+			address.symbol_prefix = Function_Prefix;
+
+			replace_operations(function_body, i, i + 1, {
+				intrinsic(Intrinsic_Kind::Dup), address, intrinsic(Intrinsic_Kind::Equal),
+				branch(Operation::Kind::If, i + 7), intrinsic(Intrinsic_Kind::Drop), *call,
+				branch(Operation::Kind::Else, i + 8), op,
+				branch(Operation::Kind::End, i + 9),
+			});
+			done_something = true;
+		}
+		return done_something;
+	}
+
+	// Applies function local passes until none of them changes the body
+	auto simplify_function(Generation_Info &geninfo, std::vector<Operation> &function_body) -> bool
+	{
+		bool done_something = false;
+		while (optimize_comptime_known_conditions(geninfo, function_body)
+			|| remove_unreachable_operations(geninfo, function_body)
+			|| remove_empty_branches(geninfo, function_body)
+			|| fold_empty_memory_operations(geninfo, function_body)
+			|| reassociate_offsets(geninfo, function_body)
+			|| minimize_stack_shuffles(geninfo, function_body)
+			|| apply_superoptimizer_rules(geninfo, function_body)
+			|| devirtualize_calls(geninfo, function_body)
+			|| remove_dead_stack_values(geninfo, function_body)
+			|| reuse_known_values(geninfo, function_body)
+			|| constant_folding(geninfo, function_body)
+			|| propagate_constant_conditions(geninfo, function_body)
+			|| remove_boolean_normalization(geninfo, function_body))
+		{
+			done_something = true;
+		}
+		return done_something;
+	}
+
+	// Clones of functions specialized for constant arguments, shared by call sites passing the same constants
+	struct Specializations
+	{
+		static constexpr unsigned Max_Count = 32;
+		static constexpr unsigned Max_Function_Length = 128;
+		static constexpr unsigned Max_Unknown_Inputs = 4;
+
+		// Name of the clone for function id and constants on top of its inputs, empty when specialization did not pay off
+		std::map<std::pair<std::uint64_t, std::vector<std::string>>, std::string> clones;
+		std::unordered_map<std::uint64_t, std::uint64_t> origins; // clone id -> id of the original function
+		unsigned count = 0;
+
+		auto origin(std::uint64_t id) const -> std::uint64_t
+		{
+			auto const it = origins.find(id);
+			return it == std::cend(origins) ? id : it->second;
+		}
+	};
+
+	// Replaces `C1 ... Ck f` (where C are integers or symbols) with call of clone of `f` that pushes constants itself, when folding them
+	// into its body makes it shorter. Recursive calls are left alone, so specialization cannot repeat forever.
+	auto specialize_calls(Generation_Info &geninfo, Specializations &specializations) -> bool
+	{
+		std::vector<std::pair<std::optional<std::uint64_t>, std::vector<Operation>*>> bodies = { { std::nullopt, &geninfo.main } };
+		for (auto &[name, word] : geninfo.words)
+			if (word.kind == Word::Kind::Function)
+				bodies.push_back({ specializations.origin(word.id), &word.function_body });
+
+		auto const specialize = [&](Word const& callee, std::string_view callee_name, std::vector<Operation> const& constants) -> Word* {
+			std::vector<std::string> values;
+			for (auto const& op : constants)
+				values.push_back(std::format("{}{}", op.symbol_prefix, op.ival));
+
+			auto [clone, inserted] = specializations.clones.try_emplace({ callee.id, std::move(values) });
+			if (!inserted) {
+				auto const word = geninfo.words.find(clone->second);
+				return word == std::end(geninfo.words) ? nullptr : &word->second;
+			}
+
+			if (specializations.count >= Specializations::Max_Count || callee.function_body.size() > Specializations::Max_Function_Length)
+				return nullptr;
+
+			auto body = callee.function_body;
+			for (auto &op : body)
+				if (op.jump != Operation::Empty_Jump)
+					op.jump += constants.size();
+			body.insert(std::begin(body), std::cbegin(constants), std::cend(constants));
+			simplify_function(geninfo, body);
+			if (body.size() >= callee.function_body.size() + constants.size())
+				return nullptr;
+
+			auto specialized = callee;
+			specialized.id = Word::word_count++;
+			specialized.function_body = std::move(body);
+			if (specialized.has_effect)
+				specialized.effect.input.resize(specialized.effect.input.size() - constants.size());
+
+			clone->second = std::format("{}'{}", callee_name, specialized.id);
+			auto &word = geninfo.words.insert({ clone->second, std::move(specialized) }).first->second;
+			word.function_name = geninfo.words.find(clone->second)->first;
+			specializations.origins[word.id] = specializations.origin(callee.id);
+			++specializations.count;
+			verbose(std::format("Specialized function {} for {} constant arguments", callee_name, constants.size()));
+			return &word;
+		};
+
+		bool done_something = false;
+		for (auto [origin, body] : bodies) {
+			auto &function_body = *body;
+
+			std::vector<bool> is_jump_target(function_body.size() + 1, false);
+			for (auto const& op : function_body)
+				if (op.jump != Operation::Empty_Jump)
+					is_jump_target[op.jump] = true;
+
+			for (auto i = 0u; i < function_body.size(); ++i) {
+				auto const& call = function_body[i];
+				if (call.kind != Operation::Kind::Call_Symbol || !call.word || call.word->kind != Word::Kind::Function)
+					continue;
+
+				auto const& callee = *call.word;
+				if (callee.is_dynamically_typed || specializations.origin(callee.id) == origin)
+					continue;
+
+				// Limited number of clones is left for calls that are executed
+				if (geninfo.profile.count(call.location, Profile_Counter::Call) == 0u)
+					continue;
+
+				// Constants directly before the call that are its inputs. Inputs of function without stack effect are not known,
+				// so it is specialized only for function addresses that it may call (which is harmless for values it does not consume).
+				auto const max_constants = callee.has_effect ? callee.effect.input.size() : Specializations::Max_Unknown_Inputs;
+				auto constants = 0u;
+				while (constants < max_constants && constants < i
+					&& (function_body[i - constants - 1].kind == Operation::Kind::Push_Int || function_body[i - constants - 1].kind == Operation::Kind::Push_Symbol)
+					&& !is_jump_target[i - constants])
+					++constants;
+				if (constants == 0)
+					continue;
+				if (!callee.has_effect && std::none_of(std::cbegin(function_body) + (i - constants), std::cbegin(function_body) + i, [](Operation const& op) {
+					return op.kind == Operation::Kind::Push_Symbol && op.symbol_prefix == Function_Prefix;
+				}))
+					continue;
+
+				auto const callee_name = std::find_if(std::cbegin(geninfo.words), std::cend(geninfo.words), [&](auto const& entry) {
+					return &entry.second == &callee;
+				})->first;
+
+				auto const first = i - constants;
+				auto const word = specialize(callee, callee_name, { std::cbegin(function_body) + first, std::cbegin(function_body) + i });
+				if (!word)
+					continue;
+
+				auto specialized_call = call;
+				specialized_call.ival = word->id;
+				specialized_call.word = word;
+				specialized_call.sval = word->function_name;
+				replace_operations(function_body, first, i + 1, { specialized_call });
+				is_jump_target.erase(std::begin(is_jump_target) + first + 1, std::begin(is_jump_target) + i + 1);
+				i = first;
+				done_something = true;
+			}
+		}
+
+		return done_something;
+	}
+
+	// Functions without signature get stack effect of their body, so that calls to them can be
+	// reasoned about like calls to typed functions. Types are not known, so they are all `any`.
+	// Callers are inferred after their callees; recursive functions stay without effect.
+	void infer_stack_effects(Generation_Info &geninfo)
+	{
+		for (bool changed = true; changed;) {
+			changed = false;
+			for (auto &[name, word] : geninfo.words) {
+				if (word.kind != Word::Kind::Function || word.has_effect || word.is_dynamically_typed)
+					continue;
+
+				auto const function = ssa::translate(geninfo, word.function_body);
+				if (!function)
+					continue;
+
+				Type any;
+				any = Type::Kind::Any;
+				word.effect.input.assign(function->parameters, any);
+				word.effect.output.assign(function->outputs.size(), any);
+				word.has_effect = true;
+				changed = true;
+				verbose(std::format("Inferred stack effect of `{}`: {} -- {}", name, function->parameters, function->outputs.size()));
+			}
+		}
+	}
+
+	void optimize(Generation_Info &geninfo)
+	{
+		static constexpr unsigned Max_Specialization_Rounds = 3;
+
+		auto const simplify = [&] {
+			while (remove_unused_words_and_strings(geninfo) || for_all_functions(geninfo, simplify_function)) {
+			}
+		};
+
+		infer_stack_effects(geninfo);
+		simplify();
+
+		// Specialization exposes constants inside clones, which may be passed further to other calls.
+		// Functions (and clones) whose `call`s became direct get stack effect, so they can be specialized too.
+		Specializations specializations;
+		for (auto round = 0u; round < Max_Specialization_Rounds; ++round) {
+			infer_stack_effects(geninfo);
+			if (!specialize_calls(geninfo, specializations))
+				break;
+			simplify();
+		}
+
+		// Guard would be added again to the `call` left in it, so speculation is done once
+		if (for_all_functions(geninfo, speculate_call_targets))
+			simplify();
+
+		// Unrolling is done once, since remainder loop has the same shape as the original one
+		if (for_all_functions(geninfo, unroll_counted_loops))
+			simplify();
+	}
 }
@@ -0,0 +1,35 @@
+#include "stacky.hh"
+
+#include <format>
+#include <fstream>
+
+// FNV-1a of operation location and counter kind, the same in every compilation of unchanged sources
+auto Profile::key(Location const& location, Profile_Counter counter, std::string_view detail) -> std::uint64_t
+{
+	std::uint64_t hash = 0xcbf29ce484222325;
+	auto const text = std::format("{}:{}:{}:{}", location.file, location.line, location.column, unsigned(counter));
+	for (auto const c : detail.empty() ? text : std::format("{}:{}", text, detail)) {
+		hash ^= std::uint8_t(c);
+		hash *= 0x100000001b3;
+	}
+	return hash;
+}
+
+auto Profile::count(Location const& location, Profile_Counter counter, std::string_view detail) const -> std::optional<std::uint64_t>
+{
+	auto const it = counts.find(key(location, counter, detail));
+	return it == std::cend(counts) ? std::nullopt : std::optional(it->second);
+}
+
+bool Profile::load(fs::path const& path)
+{
+	std::ifstream file(path, std::ios_base::binary);
+	if (!file)
+		return false;
+
+	std::uint64_t entry[2];
+	while (file.read(reinterpret_cast<char*>(entry), sizeof(entry)))
+		counts[entry[0]] += entry[1];
+
+	return file.eof() && file.gcount() == 0;
+}
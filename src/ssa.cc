@@ -0,0 +1,792 @@
+#include "ssa.hh"
+
+#include <algorithm>
+#include <ostream>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ssa
+{
+	using Stack = std::vector<Value>;
+
+	// Stack effects of dynamically typed functions are discovered by translating their bodies
+	struct Effects_Cache
+	{
+		std::unordered_map<Word const*, std::optional<std::pair<unsigned, unsigned>>> effects;
+		std::unordered_set<Word const*> in_progress;
+	};
+
+	auto translate(Generation_Info const& geninfo, std::vector<Operation> const& body, Effects_Cache &cache) -> std::optional<Function>;
+
+	auto word_effect(Generation_Info const& geninfo, Word const& word, Effects_Cache &cache) -> std::optional<std::pair<unsigned, unsigned>>
+	{
+		if (word.kind != Word::Kind::Function)
+			return std::nullopt;
+
+		if (!word.is_dynamically_typed) {
+			if (!word.has_effect)
+				return std::nullopt;
+			return std::pair { unsigned(word.effect.input.size()), unsigned(word.effect.output.size()) };
+		}
+
+		if (auto const cached = cache.effects.find(&word); cached != std::end(cache.effects))
+			return cached->second;
+
+		// Recursive dynamically typed functions are not supported
+		if (!cache.in_progress.insert(&word).second)
+			return std::nullopt;
+
+		std::optional<std::pair<unsigned, unsigned>> effect = std::nullopt;
+		if (auto const function = translate(geninfo, word.function_body, cache))
+			effect = std::pair { function->parameters, unsigned(function->outputs.size()) };
+
+		cache.in_progress.erase(&word);
+		cache.effects.insert({ &word, effect });
+		return effect;
+	}
+
+	auto call_effect(Generation_Info const& geninfo, Operation const& call) -> std::optional<std::pair<unsigned, unsigned>>
+	{
+		Effects_Cache cache;
+		return call.word ? word_effect(geninfo, *call.word, cache) : std::nullopt;
+	}
+
+	struct Builder
+	{
+		Generation_Info const& geninfo;
+		std::vector<Operation> const& body;
+		Effects_Cache &cache;
+
+		Function function = {};
+		Stack stack = {};
+		unsigned current = 0;
+		bool reachable = true;
+
+		bool failed = false;
+		unsigned missing = 0; // when stack underflows, number of missing parameters
+
+		// Stacks of all `return`s and end of body, merged at function exit
+		std::vector<std::pair<unsigned, Stack>> exits = {};
+
+		auto add(Instruction instruction) -> Value
+		{
+			instruction.block = current;
+			auto const value = Value(function.values.size());
+			function.values.push_back(std::move(instruction));
+			function.blocks[current].instructions.push_back(value);
+			return value;
+		}
+
+		auto new_block() -> unsigned
+		{
+			function.blocks.emplace_back();
+			return function.blocks.size() - 1;
+		}
+
+		void jump(unsigned from, unsigned to)
+		{
+			function.blocks[from].terminator = Block::Terminator::Jump;
+			function.blocks[from].next = to;
+			function.blocks[to].predecessors.push_back(from);
+		}
+
+		void branch(unsigned from, Value condition, unsigned then, unsigned otherwise, unsigned op)
+		{
+			auto &block = function.blocks[from];
+			block.terminator = Block::Terminator::Branch;
+			block.condition = condition;
+			block.next = then;
+			block.otherwise = otherwise;
+			block.op = op;
+			function.blocks[then].predecessors.push_back(from);
+			function.blocks[otherwise].predecessors.push_back(from);
+		}
+
+		auto require(unsigned count) -> bool
+		{
+			if (stack.size() >= count)
+				return true;
+			missing = count - stack.size();
+			failed = true;
+			return false;
+		}
+
+		// Replaces `inputs` values on top of the stack with `results` values produced by instruction
+		void apply(Instruction instruction, unsigned inputs, unsigned results)
+		{
+			if (!require(inputs))
+				return;
+
+			instruction.inputs.assign(std::end(stack) - inputs, std::end(stack));
+			instruction.results = results;
+			stack.resize(stack.size() - inputs);
+
+			auto const op = instruction.op;
+			auto const value = add(std::move(instruction));
+			if (results == 1) {
+				stack.push_back(value);
+				return;
+			}
+
+			for (auto result = 0u; result < results; ++result)
+				stack.push_back(add({ .kind = Instruction::Kind::Result, .ival = result, .inputs = { value }, .op = op }));
+		}
+
+		void translate_intrinsic(unsigned i)
+		{
+			auto const& op = body[i];
+			auto const intrinsic = [&](unsigned inputs, unsigned results) {
+				apply({ .kind = Instruction::Kind::Intrinsic, .intrinsic = op.intrinsic, .op = i }, inputs, results);
+			};
+
+			switch (op.intrinsic) {
+			case Intrinsic_Kind::Drop:
+				if (require(1)) stack.pop_back();
+				break;
+			case Intrinsic_Kind::Two_Drop:
+				if (require(2)) stack.resize(stack.size() - 2);
+				break;
+			case Intrinsic_Kind::Dup:
+				if (require(1)) stack.push_back(stack.back());
+				break;
+			case Intrinsic_Kind::Two_Dup:
+				if (require(2)) stack.insert(std::end(stack), { stack[stack.size() - 2], stack.back() });
+				break;
+			case Intrinsic_Kind::Over:
+				if (require(2)) stack.push_back(stack[stack.size() - 2]);
+				break;
+			case Intrinsic_Kind::Two_Over:
+				if (require(4)) stack.insert(std::end(stack), { stack[stack.size() - 4], stack[stack.size() - 3] });
+				break;
+			case Intrinsic_Kind::Swap:
+				if (require(2)) std::swap(stack[stack.size() - 1], stack[stack.size() - 2]);
+				break;
+			case Intrinsic_Kind::Two_Swap:
+				if (require(4)) std::rotate(std::end(stack) - 4, std::end(stack) - 2, std::end(stack));
+				break;
+			case Intrinsic_Kind::Tuck:
+				if (require(2)) stack.insert(std::end(stack) - 2, stack.back());
+				break;
+			case Intrinsic_Kind::Rot:
+				if (require(3)) std::rotate(std::end(stack) - 3, std::end(stack) - 2, std::end(stack));
+				break;
+
+			// Stack becomes addressable memory or effect is unknown
+			case Intrinsic_Kind::Top:
+			case Intrinsic_Kind::Call:
+				failed = true;
+				break;
+
+			case Intrinsic_Kind::Argc:
+			case Intrinsic_Kind::Argv:
+			case Intrinsic_Kind::Random32:
+			case Intrinsic_Kind::Random64:
+				intrinsic(0, 1);
+				break;
+
+			case Intrinsic_Kind::Boolean_Negate:
+			case Intrinsic_Kind::Load:
+				intrinsic(1, 1);
+				break;
+
+			case Intrinsic_Kind::Store:
+				intrinsic(2, 0);
+				break;
+
+			case Intrinsic_Kind::Memory_Copy:
+			case Intrinsic_Kind::Memory_Move:
+			case Intrinsic_Kind::Memory_Set:
+				intrinsic(3, 0);
+				break;
+
+			case Intrinsic_Kind::Memory_Compare:
+			case Intrinsic_Kind::Memory_Find:
+				intrinsic(3, 1);
+				break;
+
+			case Intrinsic_Kind::Div_Mod:
+				intrinsic(2, 2);
+				break;
+
+			case Intrinsic_Kind::Syscall:
+				intrinsic(op.token.sval[7] - '0' + 1, 1);
+				break;
+
+			case Intrinsic_Kind::Add:
+			case Intrinsic_Kind::Subtract:
+			case Intrinsic_Kind::Mul:
+			case Intrinsic_Kind::Div:
+			case Intrinsic_Kind::Mod:
+			case Intrinsic_Kind::Min:
+			case Intrinsic_Kind::Max:
+			case Intrinsic_Kind::Bitwise_And:
+			case Intrinsic_Kind::Bitwise_Or:
+			case Intrinsic_Kind::Bitwise_Xor:
+			case Intrinsic_Kind::Left_Shift:
+			case Intrinsic_Kind::Right_Shift:
+			case Intrinsic_Kind::Boolean_And:
+			case Intrinsic_Kind::Boolean_Or:
+			case Intrinsic_Kind::Equal:
+			case Intrinsic_Kind::Not_Equal:
+			case Intrinsic_Kind::Less:
+			case Intrinsic_Kind::Less_Eq:
+			case Intrinsic_Kind::Greater:
+			case Intrinsic_Kind::Greater_Eq:
+				intrinsic(2, 1);
+				break;
+			}
+		}
+
+		// Continues in new block reached from all given states. Values that differ between them are merged with phi nodes.
+		void merge(std::vector<std::pair<unsigned, Stack>> const& states)
+		{
+			if (states.empty()) {
+				reachable = false;
+				return;
+			}
+
+			for (auto const& [block, state] : states)
+				if (state.size() != states.front().second.size()) {
+					failed = true;
+					return;
+				}
+
+			auto const join = new_block();
+			for (auto const& [block, state] : states)
+				jump(block, join);
+
+			current = join;
+			reachable = true;
+			stack = states.front().second;
+
+			for (auto slot = 0u; slot < stack.size(); ++slot) {
+				auto const differs = std::any_of(std::cbegin(states), std::cend(states), [&](auto const& state) {
+					return state.second[slot] != stack[slot];
+				});
+				if (!differs)
+					continue;
+
+				Instruction phi = { .kind = Instruction::Kind::Phi };
+				for (auto const& [block, state] : states)
+					phi.inputs.push_back(state[slot]);
+				stack[slot] = add(std::move(phi));
+			}
+		}
+
+		auto translate_if(unsigned i) -> unsigned
+		{
+			auto const& op = body[i];
+			auto const has_else = body[op.jump - 1].kind == Operation::Kind::Else;
+			auto const else_op = op.jump - 1;
+			auto const end_op = has_else ? body[else_op].jump : op.jump;
+			if (end_op >= body.size() || body[end_op].kind != Operation::Kind::End) {
+				failed = true;
+				return i;
+			}
+
+			if (!require(1))
+				return end_op;
+			auto const condition = stack.back();
+			stack.pop_back();
+
+			auto const then_block = new_block(), else_block = new_block();
+			branch(current, condition, then_block, else_block, i);
+			auto const saved = stack;
+
+			std::vector<std::pair<unsigned, Stack>> states;
+
+			current = then_block;
+			translate_range(i + 1, has_else ? else_op : end_op);
+			if (reachable)
+				states.emplace_back(current, std::move(stack));
+
+			current = else_block;
+			stack = saved;
+			reachable = true;
+			if (has_else)
+				translate_range(else_op + 1, end_op);
+			if (reachable)
+				states.emplace_back(current, std::move(stack));
+
+			if (!failed)
+				merge(states);
+			return end_op;
+		}
+
+		auto translate_while(unsigned i) -> unsigned
+		{
+			auto end_op = i + 1;
+			while (end_op < body.size() && (body[end_op].kind != Operation::Kind::End || body[end_op].jump != i))
+				++end_op;
+			if (end_op >= body.size()) {
+				failed = true;
+				return i;
+			}
+
+			// Loop without `do` is infinite loop, left only by `return`
+			std::optional<unsigned> do_op = std::nullopt;
+			for (auto j = i + 1; j < end_op; ++j)
+				if (body[j].kind == Operation::Kind::Do && body[j].jump == end_op + 1)
+					do_op = j;
+
+			auto const header = new_block();
+			jump(current, header);
+			current = header;
+
+			// Every value on the stack may change between iterations, phis that turn out trivial are removed later
+			Stack phis;
+			for (auto& value : stack)
+				phis.push_back(value = add({ .kind = Instruction::Kind::Phi, .inputs = { value } }));
+
+			auto const back_edge = [&] {
+				if (!reachable || failed)
+					return;
+				if (stack.size() != phis.size()) {
+					failed = true;
+					return;
+				}
+				jump(current, header);
+				for (auto slot = 0u; slot < phis.size(); ++slot)
+					function.values[phis[slot]].inputs.push_back(stack[slot]);
+			};
+
+			if (!do_op) {
+				translate_range(i + 1, end_op);
+				back_edge();
+				reachable = false;
+				return end_op;
+			}
+
+			translate_range(i + 1, *do_op);
+			if (!reachable || failed || !require(1))
+				return end_op;
+
+			auto const condition = stack.back();
+			stack.pop_back();
+
+			auto const body_block = new_block(), exit_block = new_block();
+			branch(current, condition, body_block, exit_block, *do_op);
+			auto const exit_stack = stack;
+
+			current = body_block;
+			translate_range(*do_op + 1, end_op);
+			back_edge();
+
+			current = exit_block;
+			stack = exit_stack;
+			reachable = true;
+			return end_op;
+		}
+
+		void translate_range(unsigned first, unsigned last)
+		{
+			for (auto i = first; i < last && reachable && !failed; ++i) {
+				switch (auto const& op = body[i]; op.kind) {
+				case Operation::Kind::Push_Int:
+					stack.push_back(add({ .kind = Instruction::Kind::Constant, .ival = op.ival, .op = i }));
+					break;
+				case Operation::Kind::Push_Symbol:
+					stack.push_back(add({ .kind = Instruction::Kind::Symbol, .ival = op.ival, .symbol_prefix = op.symbol_prefix, .op = i }));
+					break;
+				case Operation::Kind::Cast:
+					require(1);
+					break;
+				case Operation::Kind::Intrinsic:
+					translate_intrinsic(i);
+					break;
+				case Operation::Kind::Call_Symbol:
+					if (auto const effect = op.word ? word_effect(geninfo, *op.word, cache) : std::nullopt)
+						apply({ .kind = Instruction::Kind::Call, .ival = op.ival, .op = i }, effect->first, effect->second);
+					else
+						failed = true;
+					break;
+				case Operation::Kind::Return:
+					exits.emplace_back(current, stack);
+					reachable = false;
+					break;
+				case Operation::Kind::If:
+					i = translate_if(i);
+					break;
+				case Operation::Kind::While:
+					i = translate_while(i);
+					break;
+				case Operation::Kind::Else:
+				case Operation::Kind::End:
+				case Operation::Kind::Do:
+					// Only reachable for control flow that is not structured anymore
+					failed = true;
+					break;
+				}
+			}
+		}
+	};
+
+	void replace_all_uses(Function &function, Value from, Value to)
+	{
+		for (auto &instruction : function.values)
+			std::replace(std::begin(instruction.inputs), std::end(instruction.inputs), from, to);
+		for (auto &block : function.blocks)
+			if (block.terminator == Block::Terminator::Branch && block.condition == from)
+				block.condition = to;
+		std::replace(std::begin(function.outputs), std::end(function.outputs), from, to);
+	}
+
+	// Removes phis that merge single value (with itself in loops)
+	void remove_trivial_phis(Function &function)
+	{
+		for (bool removed = true; removed;) {
+			removed = false;
+			for (auto &block : function.blocks) {
+				for (auto it = std::begin(block.instructions); it != std::end(block.instructions);) {
+					auto const phi = *it;
+					auto const& instruction = function.values[phi];
+					if (instruction.kind != Instruction::Kind::Phi) {
+						++it;
+						continue;
+					}
+
+					std::optional<Value> same = std::nullopt;
+					bool trivial = true;
+					for (auto input : instruction.inputs) {
+						if (input == phi || input == same)
+							continue;
+						if (same) {
+							trivial = false;
+							break;
+						}
+						same = input;
+					}
+
+					if (!trivial || !same) {
+						++it;
+						continue;
+					}
+
+					it = block.instructions.erase(it);
+					replace_all_uses(function, phi, *same);
+					removed = true;
+				}
+			}
+		}
+	}
+
+	auto translate(Generation_Info const& geninfo, std::vector<Operation> const& body, Effects_Cache &cache) -> std::optional<Function>
+	{
+		static constexpr unsigned Max_Parameters = 64;
+
+		for (unsigned parameters = 0;;) {
+			Builder builder { geninfo, body, cache };
+			builder.function.blocks.emplace_back();
+			builder.function.parameters = parameters;
+			for (auto i = 0u; i < parameters; ++i)
+				builder.stack.push_back(builder.add({ .kind = Instruction::Kind::Parameter, .ival = i }));
+
+			builder.translate_range(0, body.size());
+			if (builder.reachable && !builder.failed)
+				builder.exits.emplace_back(builder.current, builder.stack);
+
+			if (builder.failed) {
+				if (builder.missing == 0 || parameters + builder.missing > Max_Parameters)
+					return std::nullopt;
+				parameters += builder.missing;
+				continue;
+			}
+
+			builder.merge(builder.exits);
+			if (builder.failed)
+				return std::nullopt;
+
+			auto function = std::move(builder.function);
+			if (builder.reachable)
+				function.outputs = std::move(builder.stack);
+			remove_trivial_phis(function);
+			return function;
+		}
+	}
+
+	auto translate(Generation_Info const& geninfo, std::vector<Operation> const& body) -> std::optional<Function>
+	{
+		Effects_Cache cache;
+		return translate(geninfo, body, cache);
+	}
+
+	auto evaluate(Intrinsic_Kind intrinsic, std::uint64_t a, std::uint64_t b) -> std::optional<std::uint64_t>
+	{
+		switch (intrinsic) {
+		case Intrinsic_Kind::Add:            return a + b;
+		case Intrinsic_Kind::Subtract:       return a - b;
+		case Intrinsic_Kind::Mul:            return a * b;
+		case Intrinsic_Kind::Div:            if (b == 0) return std::nullopt; return a / b;
+		case Intrinsic_Kind::Mod:            if (b == 0) return std::nullopt; return a % b;
+		case Intrinsic_Kind::Min:            return std::min(a, b);
+		case Intrinsic_Kind::Max:            return std::max(a, b);
+		case Intrinsic_Kind::Bitwise_And:    return a & b;
+		case Intrinsic_Kind::Bitwise_Or:     return a | b;
+		case Intrinsic_Kind::Bitwise_Xor:    return a ^ b;
+		case Intrinsic_Kind::Left_Shift:     return a << (b & 63);
+		case Intrinsic_Kind::Right_Shift:    return std::uint64_t(std::int64_t(a) >> (b & 63));
+		case Intrinsic_Kind::Boolean_And:    return (a & b) != 0;
+		case Intrinsic_Kind::Boolean_Or:     return (a | b) != 0;
+		case Intrinsic_Kind::Boolean_Negate: return a == 0;
+		case Intrinsic_Kind::Equal:          return a == b;
+		case Intrinsic_Kind::Not_Equal:      return a != b;
+		case Intrinsic_Kind::Less:           return a < b;
+		case Intrinsic_Kind::Less_Eq:        return a <= b;
+		case Intrinsic_Kind::Greater:        return a > b;
+		case Intrinsic_Kind::Greater_Eq:     return a >= b;
+		default:
+			return std::nullopt;
+		}
+	}
+
+	auto propagate_constants(Function const& function) -> Constants
+	{
+		enum class State { Undefined, Constant, Overdefined };
+		struct Lattice
+		{
+			State state = State::Undefined;
+			std::uint64_t value = 0;
+			auto operator==(Lattice const&) const -> bool = default;
+		};
+
+		static constexpr Lattice Overdefined = { State::Overdefined };
+
+		std::vector<Lattice> lattice(function.values.size());
+		std::vector<bool> executable(function.blocks.size());
+		executable[0] = true;
+
+		auto const meet = [](Lattice const& lhs, Lattice const& rhs) -> Lattice {
+			if (lhs.state == State::Undefined) return rhs;
+			if (rhs.state == State::Undefined) return lhs;
+			if (lhs == rhs) return lhs;
+			return Overdefined;
+		};
+
+		auto const edge_executable = [&](unsigned from, unsigned to) -> bool {
+			if (!executable[from])
+				return false;
+			auto const& block = function.blocks[from];
+			switch (block.terminator) {
+			case Block::Terminator::Jump:
+				return block.next == to;
+			case Block::Terminator::Branch:
+				switch (auto const& condition = lattice[block.condition]; condition.state) {
+				case State::Undefined:   return false;
+				case State::Overdefined: return block.next == to || block.otherwise == to;
+				case State::Constant:    return (condition.value != 0 ? block.next : block.otherwise) == to;
+				}
+				break;
+			case Block::Terminator::Exit:
+				return false;
+			}
+			unreachable("all terminators are handled");
+		};
+
+		auto const evaluate_instruction = [&](Value value) -> Lattice {
+			auto const& instruction = function.values[value];
+			switch (instruction.kind) {
+			case Instruction::Kind::Constant:
+				return { State::Constant, instruction.ival };
+
+			case Instruction::Kind::Parameter:
+			case Instruction::Kind::Symbol:
+			case Instruction::Kind::Call:
+				return Overdefined;
+
+			case Instruction::Kind::Phi:
+				{
+					auto const& block = function.blocks[instruction.block];
+					Lattice result;
+					for (auto i = 0u; i < block.predecessors.size(); ++i)
+						if (edge_executable(block.predecessors[i], instruction.block))
+							result = meet(result, lattice[instruction.inputs[i]]);
+					return result;
+				}
+
+			case Instruction::Kind::Result:
+			case Instruction::Kind::Intrinsic:
+				{
+					auto const& source = instruction.kind == Instruction::Kind::Result ? function.values[instruction.inputs[0]] : instruction;
+					if (source.kind != Instruction::Kind::Intrinsic || source.inputs.empty() || source.inputs.size() > 2)
+						return Overdefined;
+
+					std::uint64_t inputs[2] = {};
+					bool undefined = false;
+					for (auto i = 0u; i < source.inputs.size(); ++i) {
+						switch (auto const& input = lattice[source.inputs[i]]; input.state) {
+						case State::Overdefined: return Overdefined;
+						case State::Undefined:   undefined = true; break;
+						case State::Constant:    inputs[i] = input.value; break;
+						}
+					}
+					if (undefined)
+						return {};
+
+					auto intrinsic = source.intrinsic;
+					if (intrinsic == Intrinsic_Kind::Div_Mod) {
+						if (instruction.kind != Instruction::Kind::Result)
+							return Overdefined;
+						intrinsic = instruction.ival == 0 ? Intrinsic_Kind::Mod : Intrinsic_Kind::Div;
+					}
+
+					if (auto const result = evaluate(intrinsic, inputs[0], inputs[1]))
+						return { State::Constant, *result };
+					return Overdefined;
+				}
+			}
+			unreachable("all instruction kinds are handled");
+		};
+
+		for (bool changed = true; changed;) {
+			changed = false;
+			for (auto b = 0u; b < function.blocks.size(); ++b) {
+				if (!executable[b])
+					continue;
+
+				for (auto value : function.blocks[b].instructions) {
+					// Values can only go down in lattice, which guarantees termination
+					auto const updated = meet(lattice[value], evaluate_instruction(value));
+					if (updated != lattice[value]) {
+						lattice[value] = updated;
+						changed = true;
+					}
+				}
+
+				auto const& block = function.blocks[b];
+				for (auto successor : { block.next, block.otherwise }) {
+					if (block.terminator != Block::Terminator::Exit && !executable[successor] && edge_executable(b, successor)) {
+						executable[successor] = true;
+						changed = true;
+					}
+				}
+			}
+		}
+
+		Constants constants;
+		constants.executable = std::move(executable);
+		for (auto const& value : lattice) {
+			if (value.state == State::Constant)
+				constants.values.push_back(value.value);
+			else
+				constants.values.push_back(std::nullopt);
+		}
+		return constants;
+	}
+
+	auto find_booleans(Function const& function) -> std::vector<bool>
+	{
+		// Optimistic start, values only lose being boolean, so loops carrying booleans through phi nodes keep it
+		std::vector<bool> booleans(function.values.size(), true);
+
+		auto const is_boolean = [&](Instruction const& instruction) -> bool {
+			auto const input = [&](unsigned i) { return bool(booleans[instruction.inputs[i]]); };
+			auto const is_constant = [&](unsigned i, std::uint64_t value) {
+				auto const& source = function.values[instruction.inputs[i]];
+				return source.kind == Instruction::Kind::Constant && source.ival == value;
+			};
+
+			switch (instruction.kind) {
+			case Instruction::Kind::Constant:
+				return instruction.ival <= 1;
+			case Instruction::Kind::Phi:
+				return std::all_of(std::cbegin(instruction.inputs), std::cend(instruction.inputs), [&](Value v) { return bool(booleans[v]); });
+			case Instruction::Kind::Intrinsic:
+				break;
+			default:
+				return false;
+			}
+
+			switch (instruction.intrinsic) {
+			case Intrinsic_Kind::Boolean_And:
+			case Intrinsic_Kind::Boolean_Or:
+			case Intrinsic_Kind::Boolean_Negate:
+			case Intrinsic_Kind::Equal:
+			case Intrinsic_Kind::Not_Equal:
+			case Intrinsic_Kind::Less:
+			case Intrinsic_Kind::Less_Eq:
+			case Intrinsic_Kind::Greater:
+			case Intrinsic_Kind::Greater_Eq:
+				return true;
+			case Intrinsic_Kind::Bitwise_And:
+			case Intrinsic_Kind::Min:
+				return input(0) || input(1);
+			case Intrinsic_Kind::Bitwise_Or:
+			case Intrinsic_Kind::Bitwise_Xor:
+			case Intrinsic_Kind::Mul:
+			case Intrinsic_Kind::Max:
+				return input(0) && input(1);
+			case Intrinsic_Kind::Mod:
+				return is_constant(1, 1) || is_constant(1, 2);
+			default:
+				return false;
+			}
+		};
+
+		for (bool changed = true; changed;) {
+			changed = false;
+			for (auto v = 0u; v < function.values.size(); ++v) {
+				if (booleans[v] && !is_boolean(function.values[v])) {
+					booleans[v] = false;
+					changed = true;
+				}
+			}
+		}
+		return booleans;
+	}
+
+	void print(std::ostream &out, Function const& function, std::vector<Operation> const& body, std::string_view name)
+	{
+		out << "ssa " << name << " (" << function.parameters << " parameters)\n";
+
+		auto const list = [&](auto const& values) {
+			for (auto value : values)
+				out << " %" << value;
+		};
+
+		for (auto b = 0u; b < function.blocks.size(); ++b) {
+			auto const& block = function.blocks[b];
+			out << "b" << b << ":";
+			if (!block.predecessors.empty()) {
+				out << " ; from";
+				for (auto predecessor : block.predecessors)
+					out << " b" << predecessor;
+			}
+			out << '\n';
+
+			for (auto value : block.instructions) {
+				auto const& instruction = function.values[value];
+				out << "\t";
+				if (instruction.results > 0)
+					out << "%" << value << " = ";
+				switch (instruction.kind) {
+				case Instruction::Kind::Parameter: out << "parameter " << instruction.ival; break;
+				case Instruction::Kind::Constant:  out << "constant " << instruction.ival; break;
+				case Instruction::Kind::Symbol:    out << "symbol " << instruction.symbol_prefix << instruction.ival; break;
+				case Instruction::Kind::Intrinsic: out << body[instruction.op].token.sval; list(instruction.inputs); break;
+				case Instruction::Kind::Call:      out << "call " << body[instruction.op].token.sval; list(instruction.inputs); break;
+				case Instruction::Kind::Result:    out << "result " << instruction.ival << " of %" << instruction.inputs[0]; break;
+				case Instruction::Kind::Phi:
+					out << "phi";
+					for (auto i = 0u; i < instruction.inputs.size(); ++i)
+						out << " [%" << instruction.inputs[i] << ", b" << block.predecessors[i] << ']';
+					break;
+				}
+				out << '\n';
+			}
+
+			switch (block.terminator) {
+			case Block::Terminator::Jump:
+				out << "\tjump b" << block.next << '\n';
+				break;
+			case Block::Terminator::Branch:
+				out << "\tbranch %" << block.condition << " b" << block.next << " b" << block.otherwise << '\n';
+				break;
+			case Block::Terminator::Exit:
+				out << "\texit";
+				list(function.outputs);
+				out << '\n';
+				break;
+			}
+		}
+	}
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "stacky.hh"
+
+// Static single assignment form of function bodies. Every value that lives on the stack
+// is defined exactly once, stack manipulation intrinsics disappear and values flowing
+// into `if` / `while` joins are merged with phi nodes. Backend lowers bodies without
+// branches from this form, assigning registers to values.
+namespace ssa
+{
+	using Value = unsigned;
+
+	struct Instruction
+	{
+		enum class Kind
+		{
+			Parameter, // value that was on the stack before function body started
+			Constant,
+			Symbol,
+			Intrinsic,
+			Call,
+			Result,    // n-th value produced by instruction with multiple results
+			Phi,
+		};
+
+		Kind kind;
+		Intrinsic_Kind intrinsic{};
+
+		// Constant value, symbol or word id, index of parameter or result
+		std::uint64_t ival = 0;
+		std::string_view symbol_prefix = {};
+
+		// For phi nodes inputs are ordered as predecessors of block
+		std::vector<Value> inputs = {};
+		unsigned results = 1;
+
+		unsigned block = 0;
+		unsigned op = Operation::Empty_Jump; // index of operation that introduced this instruction
+	};
+
+	struct Block
+	{
+		enum class Terminator
+		{
+			Jump,
+			Branch,
+			Exit,
+		};
+
+		std::vector<Value> instructions;
+		std::vector<unsigned> predecessors;
+
+		Terminator terminator = Terminator::Exit;
+		Value condition = 0;
+		unsigned next = 0;      // target of jump or branch when condition is true
+		unsigned otherwise = 0; // target of branch when condition is false
+		unsigned op = Operation::Empty_Jump; // `if` or `do` operation for branches
+	};
+
+	struct Function
+	{
+		std::vector<Instruction> values;
+		std::vector<Block> blocks;
+
+		unsigned parameters = 0;
+		std::vector<Value> outputs; // stack when function exits, from bottom to top
+	};
+
+	// Translates function body into SSA form. Fails for bodies whose stack layout cannot
+	// be determined statically (dynamic `call`, `top`, inconsistent stack in branches)
+	auto translate(Generation_Info const& geninfo, std::vector<Operation> const& body) -> std::optional<Function>;
+
+	// Number of values consumed and produced by call of a function, when it is known
+	auto call_effect(Generation_Info const& geninfo, Operation const& call) -> std::optional<std::pair<unsigned, unsigned>>;
+
+	// Evaluates binary (or unary with b ignored) intrinsic the same way as generated code does,
+	// nothing for intrinsics that are not pure computations or would trap
+	auto evaluate(Intrinsic_Kind intrinsic, std::uint64_t a, std::uint64_t b) -> std::optional<std::uint64_t>;
+
+	struct Constants
+	{
+		std::vector<std::optional<std::uint64_t>> values;
+		std::vector<bool> executable;
+	};
+
+	// Sparse conditional constant propagation, values of the same semantics as generated code
+	auto propagate_constants(Function const& function) -> Constants;
+
+	// Values proven to be 0 or 1, like results of comparisons, boolean operations or phi nodes merging them
+	auto find_booleans(Function const& function) -> std::vector<bool>;
+
+	void print(std::ostream &out, Function const& function, std::vector<Operation> const& body, std::string_view name);
+}
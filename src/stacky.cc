@@ -34,6 +34,8 @@ namespace fs = std::filesystem;
 
 #include "arguments.hh"
 #include "stacky.hh"
+#include "ssa.hh"
+#include "superoptimizer.hh"
 
 static inline void register_intrinsic(Words &words, std::string_view name, Intrinsic_Kind kind)
 {
@@ -74,6 +76,11 @@ void register_intrinsics(Words &words)
 	register_intrinsic(words, "drop"sv,      Intrinsic_Kind::Drop);
 	register_intrinsic(words, "dup"sv,       Intrinsic_Kind::Dup);
 	register_intrinsic(words, "max"sv,       Intrinsic_Kind::Max);
+	register_intrinsic(words, "memchr"sv,    Intrinsic_Kind::Memory_Find);
+	register_intrinsic(words, "memcmp"sv,    Intrinsic_Kind::Memory_Compare);
+	register_intrinsic(words, "memcpy"sv,    Intrinsic_Kind::Memory_Copy);
+	register_intrinsic(words, "memmove"sv,   Intrinsic_Kind::Memory_Move);
+	register_intrinsic(words, "memset"sv,    Intrinsic_Kind::Memory_Set);
 	register_intrinsic(words, "min"sv,       Intrinsic_Kind::Min);
 	register_intrinsic(words, "mod"sv,       Intrinsic_Kind::Mod);
 	register_intrinsic(words, "or"sv,        Intrinsic_Kind::Boolean_Or);
@@ -161,6 +168,11 @@ auto main(int argc, char **argv) -> int
 {
 	compiler_arguments.parse(argc, argv);
 
+	if (compiler_arguments.superopt_mode) {
+		superoptimizer::generate_rules(std::cout, compiler_arguments.superopt_length);
+		return 0;
+	}
+
 	std::vector<Token> tokens;
 
 	bool compile = true;
@@ -248,10 +260,13 @@ auto main(int argc, char **argv) -> int
 	if (Compilation_Failed)
 		return 1;
 
+	optimizer::infer_purity(geninfo);
+
 	if (compiler_arguments.dump_words_effects) {
 		for (auto const& [name, word] : geninfo.words) {
 			if (!word.has_effect) continue;
-			std::cout << std::format("`{}`: {}\n", name, word.effect.string());
+			auto const purity = !word.is_pure ? "" : word.reads_memory ? " (pure, reads memory)" : " (pure)";
+			std::cout << std::format("`{}`: {}{}\n", name, word.effect.string(), purity);
 		}
 	}
 
@@ -273,8 +288,33 @@ auto main(int argc, char **argv) -> int
 		typecheck(geninfo, geninfo.main);
 	}
 
+	if (!compiler_arguments.profile_input.empty() && !geninfo.profile.load(compiler_arguments.profile_input))
+		error_fatal(std::format("cannot read profile {}", compiler_arguments.profile_input.c_str()));
+	if (!geninfo.profile.counts.empty())
+		verbose(std::format("Loaded {} profile counters", geninfo.profile.counts.size()));
+
 	optimizer::optimize(geninfo);
 	generate_jump_targets_lookup(geninfo);
+
+	if (compiler_arguments.dump_ssa) {
+		auto const dump = [&](std::vector<Operation> const& body, std::string_view name) {
+			if (auto const function = ssa::translate(geninfo, body))
+				ssa::print(std::cout, *function, body, name);
+			else
+				std::cout << "ssa " << name << ": cannot be translated\n";
+		};
+
+		// Words are kept in unordered map, so print functions sorted by name for stable output
+		std::vector<std::string_view> names;
+		for (auto const& [name, word] : geninfo.words)
+			if (word.kind == Word::Kind::Function)
+				names.push_back(name);
+		std::sort(std::begin(names), std::end(names));
+
+		dump(geninfo.main, "main");
+		for (auto const name : names)
+			dump(geninfo.words.at(std::string(name)).function_body, name);
+	}
 	linux::x86_64::generate_assembly(geninfo, compiler_arguments.assembly);
 
 	if (Compilation_Failed)
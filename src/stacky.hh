@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 #include <optional>
@@ -18,7 +19,10 @@ namespace fs = std::filesystem;
 #define  String_Prefix              "_Stacky_string_"
 #define  Function_Prefix            "_Stacky_fun_"
 #define  Function_Body_Prefix       "_Stacky_funinstr_"
+#define  Function_Entry_Prefix      "_Stacky_funentry_"
+#define  Function_Register_Prefix   "_Stacky_funreg_"
 #define  Anonymous_Function_Prefix  "_Stacky_anonymous_"
+#define  Outlined_Prefix            "_Stacky_outlined_"
 
 #include "errors.hh"
 #include "arguments.hh"
@@ -93,6 +97,11 @@ enum class Intrinsic_Kind
 	Store,
 	Top,
 	Call,
+	Memory_Compare,
+	Memory_Copy,
+	Memory_Find,
+	Memory_Move,
+	Memory_Set,
 
 	// --- STDLIB, OS ---
 	Argv,
@@ -102,6 +111,20 @@ enum class Intrinsic_Kind
 	Last = Syscall,
 };
 
+// Kinds of execution counters collected by `--profile-generate`, each is attached to operation:
+// entries of `if` and `else` bodies and arrivals at `end` of `if` without `else` count for `if`,
+// iterations of loop body for `do`, executions of call for the call itself and
+// for `call` intrinsic, how many times each of address taken functions was its target
+enum class Profile_Counter
+{
+	Then,
+	Else,
+	Join,
+	Loop_Body,
+	Call,
+	Call_Target,
+};
+
 struct Location
 {
 	std::string_view file;
@@ -261,6 +284,14 @@ struct Word
 	Stack_Effect effect;
 	bool is_dynamically_typed = false;
 
+	// Function has no side effects (stores, syscalls, random numbers), so calls with the same
+	// inputs give the same results, unless it reads memory that was changed in between
+	bool is_pure = false;
+	bool reads_memory = false;
+
+	// Pure function without loops and recursion, so calls whose results are unused can be removed
+	bool terminates = false;
+
 	Location location;
 	std::string_view function_name;
 };
@@ -274,6 +305,23 @@ struct Label_Info
 	auto operator<=>(Label_Info const&) const = default;
 };
 
+// Execution counts collected by instrumented executable. Counters are identified by source location
+// of their operation, so they match operations of recompiled program, and repeated ones (in clones
+// of functions or unrolled loops) are summed.
+struct Profile
+{
+	std::unordered_map<std::uint64_t, std::uint64_t> counts;
+
+	// Detail distinguishes counters of the same kind attached to one operation, like call targets
+	static auto key(Location const& location, Profile_Counter counter, std::string_view detail = {}) -> std::uint64_t;
+
+	// Nothing when profile was not loaded or operation was not instrumented
+	auto count(Location const& location, Profile_Counter counter, std::string_view detail = {}) const -> std::optional<std::uint64_t>;
+
+	// Adds counts from file written by instrumented executable, which is a sequence of (key, count) pairs
+	bool load(fs::path const& path);
+};
+
 struct Generation_Info
 {
 	std::unordered_map<std::string, unsigned> strings;
@@ -282,6 +330,8 @@ struct Generation_Info
 
 	std::unordered_set<std::string> undefined_words;
 	std::set<Label_Info> jump_targets_lookup;
+
+	Profile profile;
 };
 
 // Unicode support
@@ -310,7 +360,31 @@ void typecheck(Generation_Info &geninfo, Word const& word);
 // Optimization
 namespace optimizer
 {
+	// Marks functions that are pure, computed before optimization since it does not change it
+	void infer_purity(Generation_Info &geninfo);
 	void optimize(Generation_Info &geninfo);
+
+	// Applies pure stack manipulation intrinsic to the stack (top at the back),
+	// which must hold enough values
+	template<typename T>
+	void apply_stack_shuffle(Intrinsic_Kind kind, std::vector<T> &stack)
+	{
+		auto const top = std::end(stack);
+		switch (kind) {
+		case Intrinsic_Kind::Drop:     stack.pop_back(); break;
+		case Intrinsic_Kind::Two_Drop: stack.resize(stack.size() - 2); break;
+		case Intrinsic_Kind::Dup:      stack.push_back(stack.back()); break;
+		case Intrinsic_Kind::Over:     stack.push_back(stack[stack.size() - 2]); break;
+		case Intrinsic_Kind::Two_Dup:  stack.insert(top, { top[-2], top[-1] }); break;
+		case Intrinsic_Kind::Two_Over: stack.insert(top, { top[-4], top[-3] }); break;
+		case Intrinsic_Kind::Swap:     std::swap(stack[stack.size() - 1], stack[stack.size() - 2]); break;
+		case Intrinsic_Kind::Rot:      std::rotate(top - 3, top - 2, top); break;
+		case Intrinsic_Kind::Tuck:     stack.insert(top - 2, stack.back()); break;
+		case Intrinsic_Kind::Two_Swap: std::rotate(top - 4, top - 2, top); break;
+		default:
+			unreachable("Only stack manipulation intrinsics are expected");
+		}
+	}
 }
 
 // Platform dependent code generation
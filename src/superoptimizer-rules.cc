@@ -0,0 +1,1756 @@
+// Generated by `stacky superopt --length 3`, do not edit.
+#include "superoptimizer.hh"
+
+namespace superoptimizer
+{
+	constexpr Rule Rules[] = {
+		// dup - => drop 0
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup bit-and =>
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 0, {} } },
+		// dup bit-or =>
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 0, {} } },
+		// dup bit-xor => drop 0
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup min =>
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 0, {} } },
+		// dup max =>
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 0, {} } },
+		// dup = => drop 1
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// dup != => drop 0
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup < => drop 0
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup <= => drop 1
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// dup > => drop 0
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup >= => drop 1
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// dup and => 1 min
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// dup or => 1 min
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// swap + => +
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// swap * => *
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } } },
+		// swap bit-and => bit-and
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// swap bit-or => bit-or
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } } },
+		// swap bit-xor => bit-xor
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } } },
+		// swap min => min
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// swap max => max
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// swap = => =
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// swap != => !=
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// swap < => >
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// swap <= => >=
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// swap > => <
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// swap >= => <=
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// swap and => and
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// swap or => or
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// + drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// + 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// - drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// - 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// - ! => =
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// * drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// * 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// bit-and drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// bit-and 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// bit-or drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// bit-or 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// bit-xor drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// bit-xor 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// bit-xor ! => =
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// << drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// << 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// >> drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// >> 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// min drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// min 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// max drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// max 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// max ! => bit-or !
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// = drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// = 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// = and => = bit-and
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// = or => != >=
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// = ! => !=
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// != drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// != 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// != and => != bit-and
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// != ! => =
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// < drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// < 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// < and => < bit-and
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// < ! => >=
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// <= drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// <= 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// <= and => <= bit-and
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// <= or => > >=
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// <= ! => >
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// > drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// > 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// > and => > bit-and
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// > ! => <=
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// >= drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// >= 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// >= and => >= bit-and
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// >= or => < >=
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// >= ! => <
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// and drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// and 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// and and => and bit-and
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// and or => bit-and or
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// and ! => bit-and !
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// or drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// or 2drop => drop 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// or and => or bit-and
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// or ! => bit-or !
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// ! drop => drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// ! 2drop => 2drop
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// ! < => bit-or !
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// ! >= => or
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// ! and => ! bit-and
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// ! ! => 1 min
+		{ { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 0 2drop => drop
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// 0 + =>
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 0, {} } },
+		// 0 - =>
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } }, { 0, {} } },
+		// 0 * => drop 0
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 bit-and => drop 0
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 bit-or =>
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 0, {} } },
+		// 0 bit-xor =>
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 0, {} } },
+		// 0 << =>
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 0, {} } },
+		// 0 >> =>
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 0, {} } },
+		// 0 min => drop 0
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 max =>
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 0, {} } },
+		// 0 = => !
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 0 != => 1 min
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 0 < => drop 0
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 <= => !
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 0 > => 1 min
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 0 >= => drop 1
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 0 and => drop 0
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 or => 1 min
+		{ { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 1 2drop => drop
+		{ { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// 1 * =>
+		{ { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 0, {} } },
+		// 1 << => dup +
+		{ { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// 1 < => !
+		{ { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 1 >= => 1 min
+		{ { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 1 and => 1 bit-and
+		{ { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// 1 or => drop 1
+		{ { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 2drop < or => 2drop >= >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// dup over - => 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } }, { 1, { { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup over bit-and => dup
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// dup over bit-or => dup
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// dup over bit-xor => 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 1, { { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup over min => dup
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// dup over max => dup
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// dup over = => 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// dup over != => 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 1, { { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup over < => 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 1, { { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup over <= => 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 1, { { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// dup over > => 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 1, { { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup over >= => 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 1, { { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// dup over and => dup 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// dup over or => dup 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// dup 2dup - => dup 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup 2dup bit-and => dup dup
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// dup 2dup bit-or => dup dup
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// dup 2dup bit-xor => dup 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup 2dup min => dup dup
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// dup 2dup max => dup dup
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// dup 2dup = => dup 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// dup 2dup != => dup 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup 2dup < => dup 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup 2dup <= => dup 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// dup 2dup > => dup 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup 2dup >= => dup 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// dup << or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// dup << ! => !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// dup ! + => 1 max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// dup ! * => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup ! bit-and => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup ! bit-or => 1 max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// dup ! bit-xor => 1 max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// dup ! << =>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 0, {} } },
+		// dup ! >> =>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 0, {} } },
+		// dup ! min => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup ! max => 1 max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// dup ! = => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// dup ! != => drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// dup ! <= => !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// dup ! > => 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// dup ! or => drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// dup 0 swap => 0 over
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// dup 0 rot => 0 over
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// dup 0 tuck => 0 2dup
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" } } } },
+		// dup 1 swap => 1 over
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// dup 1 rot => 1 over
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// dup 1 tuck => 1 2dup
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" } } } },
+		// over rot - => swap drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// over rot bit-and => swap
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// over rot bit-or => swap
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// over rot bit-xor => swap drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// over rot min => swap
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// over rot max => swap
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// over rot = => swap drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// over rot != => swap drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// over rot < => swap drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// over rot <= => swap drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// over rot > => swap drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// over rot >= => swap drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// over rot and => swap 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// over rot or => swap 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// over + = => swap drop !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// over + or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over - + => swap drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// over - and => over bit-and !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// over - or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over * or => drop 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// over bit-and bit-and => bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// over bit-and bit-or => drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// over bit-and min => bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// over bit-and max => drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// over bit-and < => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// over bit-and >= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// over bit-and and => and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// over bit-and or => drop 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// over bit-or bit-and => drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// over bit-or bit-or => bit-or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } } },
+		// over bit-or min => drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// over bit-or max => bit-or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } } },
+		// over bit-or <= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// over bit-or > => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// over bit-or and => drop 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// over bit-or or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over bit-xor bit-or => bit-or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } } },
+		// over bit-xor bit-xor => swap drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// over bit-xor = => swap drop !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// over bit-xor and => over bit-and !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// over bit-xor or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over << or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over >> or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over min min => min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// over min max => drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// over min = => <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// over min != => >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// over min < => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// over min <= => <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// over min > => >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// over min >= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// over min or => drop 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// over max min => drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// over max max => max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// over max = => >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// over max != => <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// over max < => <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// over max <= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// over max > => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// over max >= => >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// over max or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over = max => ! max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// over = < => bit-or !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// over = >= => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over != >= => ! or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over != or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over < min => >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// over < max => drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// over < = => ! <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// over < != => ! >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// over < < => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// over < <= => ! <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// over < > => ! >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// over < >= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// over < or => drop 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// over <= max => ! max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// over <= < => bit-or !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// over <= >= => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over > >= => ! or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over > or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over >= max => drop 1 max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// over >= < => drop !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// over >= >= => drop 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// over and min => and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// over and max => drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// over and = => 1 bit-and <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// over and != => 1 bit-and >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// over and < => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// over and <= => 1 bit-and <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// over and > => 1 bit-and >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// over and >= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// over or * => drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// over or bit-and => drop 1 bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// over or << => drop dup +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// over or >> => drop 1 >>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } } },
+		// over or min => drop 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// over or max => over != max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// over or <= => drop 1 <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// over or > => drop 1 >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// over or >= => ! or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// over or or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 2dup rot - => drop dup 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 2dup rot bit-and => over swap
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 2dup rot bit-or => over swap
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 2dup rot bit-xor => drop dup 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 2dup rot min => over swap
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 2dup rot max => over swap
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 2dup rot = => drop dup 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 2dup rot != => drop dup 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 2dup rot < => drop dup 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 2dup rot <= => drop dup 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 2dup rot > => drop dup 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 2dup rot >= => drop dup 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 2dup + = => drop dup !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 2dup + or => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 2dup - + => drop dup
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 2dup - and => 2dup bit-and !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// 2dup - or => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 2dup * or => 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 2dup bit-and bit-and => over bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// 2dup bit-and bit-or =>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 0, {} } },
+		// 2dup bit-and min => over bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// 2dup bit-and max =>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 0, {} } },
+		// 2dup bit-and < => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 2dup bit-and >= => drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 2dup bit-and and => over and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// 2dup bit-and or => 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 2dup bit-or bit-and =>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 0, {} } },
+		// 2dup bit-or bit-or => over bit-or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } } },
+		// 2dup bit-or min =>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 0, {} } },
+		// 2dup bit-or max => over bit-or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } } },
+		// 2dup bit-or <= => drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 2dup bit-or > => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 2dup bit-or and => 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 2dup bit-or or => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 2dup bit-xor bit-or => over bit-or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } } },
+		// 2dup bit-xor bit-xor => drop dup
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 2dup bit-xor = => drop dup !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 2dup bit-xor and => 2dup bit-and !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// 2dup bit-xor or => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 2dup << or => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 2dup >> or => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 2dup min min => over min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 2dup min max =>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 0, {} } },
+		// 2dup min = => over <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// 2dup min != => over >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// 2dup min < => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 2dup min <= => over <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// 2dup min > => over >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// 2dup min >= => drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 2dup min or => 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 2dup max min =>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 0, {} } },
+		// 2dup max max => over max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// 2dup max = => over >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// 2dup max != => over <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// 2dup max < => over <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// 2dup max <= => drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 2dup max > => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 2dup max >= => over >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// 2dup max or => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 2dup = max => over ! max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// 2dup = < => over bit-or !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 2dup = >= => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 2dup != < => ! over min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 2dup != or => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 2dup < min => over >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// 2dup < max =>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 0, {} } },
+		// 2dup < < => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 2dup < >= => drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 2dup < or => 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 2dup <= max => over ! max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// 2dup <= < => over bit-or !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 2dup <= >= => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 2dup > < => ! over min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 2dup > or => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 2dup >= max => 1 max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// 2dup >= < => !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 2dup >= >= => 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 2dup and min => over and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// 2dup and max =>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 0, {} } },
+		// 2dup and < => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 2dup and >= => drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 2dup or * =>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 0, {} } },
+		// 2dup or bit-and => 1 bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// 2dup or << => dup +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// 2dup or >> => 1 >>
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } } },
+		// 2dup or min => 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 2dup or max => 2dup != max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// 2dup or < => ! over min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 2dup or <= => 1 <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// 2dup or > => 1 >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// 2dup or or => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// swap - + => - -
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } } },
+		// swap - - => - +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// swap - = => - + !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// swap ! bit-and => 1 bit-and <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// swap ! or => ! * !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// swap 0 swap => 0 rot
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } } },
+		// swap 0 rot => 0 swap
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// swap 0 tuck => 0 rot over
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" } } }, { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// swap 1 swap => 1 rot
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } } },
+		// swap 1 rot => 1 swap
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// swap 1 tuck => 1 rot over
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// rot + + => + +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// rot + = => - =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// rot + != => - !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// rot - - => - +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// rot - = => - + !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// rot * * => * *
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } } },
+		// rot bit-and bit-and => bit-and bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// rot bit-and and => bit-and and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// rot bit-or bit-or => bit-or bit-or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } } },
+		// rot bit-xor bit-xor => bit-xor bit-xor
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } } },
+		// rot bit-xor = => bit-xor =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// rot bit-xor != => bit-xor !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// rot min min => min min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// rot max max => max max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// rot = >= => rot - or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// rot != or => rot - or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// rot < or => rot >= >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// rot > or => rot <= >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// rot 0 2swap => 0 rot rot
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Swap, 0, "2swap" } } }, { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } } },
+		// rot 1 2swap => 1 rot rot
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Swap, 0, "2swap" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } } },
+		// tuck + + => dup + +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// tuck + = => drop !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// tuck + != => drop 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// tuck + <= => over + <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// tuck + > => over + >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// tuck + or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// tuck - + => drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// tuck - = => dup + =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// tuck - != => dup + !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck - and => over bit-or !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck - or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// tuck * * => dup * *
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } } },
+		// tuck * or => over + !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck bit-and - => over bit-or bit-xor
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } } },
+		// tuck bit-and bit-and => bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// tuck bit-and bit-or => swap drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// tuck bit-and bit-xor => over bit-or bit-xor
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } } },
+		// tuck bit-and min => bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// tuck bit-and max => swap drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// tuck bit-and = => over bit-or =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// tuck bit-and != => over bit-or !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck bit-and < => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// tuck bit-and <= => over bit-or =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// tuck bit-and > => over bit-or !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck bit-and >= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// tuck bit-and and => and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// tuck bit-and or => over + !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck bit-or bit-and => swap drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// tuck bit-or bit-or => bit-or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } } },
+		// tuck bit-or bit-xor => over bit-and -
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } } },
+		// tuck bit-or min => swap drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// tuck bit-or max => bit-or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } } },
+		// tuck bit-or = => over bit-and =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// tuck bit-or != => over bit-and !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck bit-or < => over bit-and !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck bit-or <= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// tuck bit-or > => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// tuck bit-or >= => over bit-and =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// tuck bit-or and => over + !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck bit-or or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// tuck bit-xor bit-and => over bit-or bit-xor
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } } },
+		// tuck bit-xor bit-or => bit-or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } } },
+		// tuck bit-xor bit-xor => drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// tuck bit-xor = => drop !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// tuck bit-xor != => drop 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// tuck bit-xor and => over bit-or !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck bit-xor or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// tuck << * => dup << *
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } } },
+		// tuck << or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// tuck >> or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// tuck min bit-xor => over max bit-xor
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } } },
+		// tuck min min => min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// tuck min max => swap drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// tuck min = => >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// tuck min != => <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// tuck min < => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// tuck min <= => >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// tuck min > => <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// tuck min >= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// tuck min or => over + !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck max bit-xor => over min bit-xor
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } } },
+		// tuck max min => swap drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// tuck max max => max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// tuck max = => <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// tuck max != => >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// tuck max < => >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// tuck max <= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// tuck max > => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// tuck max >= => <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// tuck max or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// tuck = * => over = *
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } } },
+		// tuck = bit-and => over = bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// tuck = min => over = min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// tuck = max => swap ! max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// tuck = < => bit-or !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// tuck = >= => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// tuck != < => ! min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// tuck != >= => ! * !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// tuck != or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// tuck < min => <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// tuck < max => swap drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// tuck < < => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// tuck < >= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// tuck < or => over + !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck <= max => swap ! max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// tuck <= < => bit-or !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// tuck <= >= => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// tuck > < => ! min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// tuck > >= => ! * !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// tuck > or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// tuck >= min => 1 - >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// tuck >= = => 1 = min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// tuck >= < => swap drop !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// tuck >= >= => over + !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck and min => and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// tuck and max => swap drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// tuck and < => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// tuck and >= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// tuck or * => swap drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// tuck or min => over + !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// tuck or max => tuck != max
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } } },
+		// tuck or < => ! min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// tuck or >= => ! * !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// tuck or or => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// tuck ! swap => dup ! rot
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } } },
+		// tuck ! rot => dup ! swap
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// + rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// + < or => + >= >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// + > or => + <= >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// - rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// - 1 min => !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// * rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// * < or => * >= >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// bit-and rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// bit-and < or => bit-and >= >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// bit-and > or => bit-and <= >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// bit-and ! or => and >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// bit-and 1 min => and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// bit-or rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// bit-or 1 min => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// bit-xor rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// bit-xor 1 min => !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// << rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// >> rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// min rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// max rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// max rot or => bit-or rot or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// max min ! => bit-or min !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// max 1 min => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// max 1 = => bit-or 1 =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// max 1 != => bit-or 1 !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// max 1 <= => bit-or 1 <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// max 1 > => bit-or 1 >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// = dup * => =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// = dup << => = dup +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// = dup >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// = over and => = over bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// = over or => != over <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// = 2dup and => = 2dup bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// = rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// = rot <= => - rot or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// = rot and => = rot bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// = tuck and => = tuck bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// = bit-and and => = bit-and bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// = 1 bit-and => =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// = 1 bit-or => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// = 1 bit-xor => !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// = 1 >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// = 1 min => =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// = 1 max => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// = 1 = => =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// = 1 != => !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// = 1 <= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// = 1 > => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// != dup * => !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// != dup << => != dup +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// != dup >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// != over and => != over bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// != 2dup and => != 2dup bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// != rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// != rot and => != rot bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// != rot or => - rot or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// != tuck and => != tuck bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// != * ! => - min !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// != bit-and and => != bit-and bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// != >> ! => != <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// != min and => != min bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// != min ! => - min !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// != 1 bit-and => !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// != 1 bit-or => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// != 1 bit-xor => =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// != 1 >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// != 1 min => !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// != 1 max => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// != 1 = => !=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// != 1 != => =
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } } },
+		// != 1 <= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// != 1 > => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// < dup * => <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// < dup << => < dup +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// < dup >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// < over and => < over bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// < 2dup and => < 2dup bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// < rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// < rot and => < rot bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// < rot or => >= rot <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// < tuck and => < tuck bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// < bit-and and => < bit-and bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// < >> ! => < <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// < min and => < min bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// < min ! => < * !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// < 1 bit-and => <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// < 1 bit-or => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// < 1 bit-xor => >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// < 1 >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// < 1 min => <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// < 1 max => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// < 1 = => <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// < 1 != => >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// < 1 <= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// < 1 > => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// <= dup * => <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// <= dup << => <= dup +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// <= dup >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// <= over and => <= over bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// <= over or => > over <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// <= 2dup and => <= 2dup bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// <= rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// <= rot and => <= rot bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// <= rot or => > rot <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// <= tuck and => <= tuck bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// <= bit-and and => <= bit-and bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// <= bit-or ! => > <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// <= >> ! => <= <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// <= min and => <= min bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// <= min ! => <= * !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// <= 1 bit-and => <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// <= 1 bit-or => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// <= 1 bit-xor => >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// <= 1 >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// <= 1 min => <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// <= 1 max => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// <= 1 = => <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// <= 1 != => >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// <= 1 <= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// <= 1 > => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// > dup * => >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// > dup << => > dup +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// > dup >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// > over and => > over bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// > 2dup and => > 2dup bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// > rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// > rot and => > rot bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// > rot or => <= rot <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// > tuck and => > tuck bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// > bit-and and => > bit-and bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// > >> ! => > <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// > min and => > min bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// > min ! => > * !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// > 1 bit-and => >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// > 1 bit-or => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// > 1 bit-xor => <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// > 1 >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// > 1 min => >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// > 1 max => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// > 1 = => >
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+		// > 1 != => <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// > 1 <= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// > 1 > => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// >= dup * => >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// >= dup << => >= dup +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// >= dup >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// >= over and => >= over bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// >= over or => < over <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// >= 2dup and => >= 2dup bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// >= rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// >= rot and => >= rot bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// >= rot or => < rot <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// >= tuck and => >= tuck bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// >= bit-and and => >= bit-and bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// >= bit-or ! => < <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// >= >> ! => >= <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// >= min and => >= min bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// >= min ! => >= * !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// >= 1 bit-and => >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// >= 1 bit-or => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// >= 1 bit-xor => <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// >= 1 >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// >= 1 min => >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// >= 1 max => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// >= 1 = => >=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } } },
+		// >= 1 != => <
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } } },
+		// >= 1 <= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// >= 1 > => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// and dup * => and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// and dup << => and dup +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// and dup >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// and over and => and over bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// and over or => bit-and over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// and 2dup and => and 2dup bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// and rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// and rot and => and rot bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// and rot or => bit-and rot or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// and tuck and => and tuck bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// and * ! => bit-and min !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// and bit-and and => and bit-and bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// and >> ! => and <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// and min and => and min bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// and min ! => bit-and min !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// and 1 bit-and => and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// and 1 bit-or => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// and 1 bit-xor => bit-and !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// and 1 >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// and 1 min => and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// and 1 max => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// and 1 = => and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } } },
+		// and 1 != => bit-and !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// and 1 <= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// and 1 > => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// or dup * => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// or dup << => or dup +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// or dup >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// or over and => or over bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// or 2dup and => or 2dup bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// or rot 2drop => drop rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// or rot and => or rot bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// or rot or => bit-or rot or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// or tuck and => or tuck bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// or * ! => bit-or min !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// or bit-and and => or bit-and bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// or min ! => bit-or min !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// or 1 bit-and => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// or 1 bit-or => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// or 1 bit-xor => bit-or !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// or 1 >> => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// or 1 min => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// or 1 max => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// or 1 = => or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// or 1 != => bit-or !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// or 1 <= => 2drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// or 1 > => 2drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// ! dup * => !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// ! dup << => ! dup +
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// ! dup >> => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// ! over <= => over or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// ! over > => over bit-or !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// ! over and => ! over bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// ! 2dup and => ! 2dup bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// ! rot 2drop => rot 2drop
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } } },
+		// ! rot <= => rot or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// ! rot > => rot bit-or !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// ! rot and => ! rot bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// ! tuck and => ! tuck bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// ! bit-and and => ! bit-and bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// ! >> ! => ! <=
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// ! min and => ! min bit-and
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// ! min ! => ! * !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// ! = >= => ! - or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// ! != or => ! - or
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// ! 1 bit-and => !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// ! 1 bit-or => drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// ! 1 bit-xor => 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// ! 1 >> => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// ! 1 min => !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// ! 1 max => drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// ! 1 = => !
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// ! 1 != => 1 min
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// ! 1 <= => drop 1
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// ! 1 > => drop 0
+		{ { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 over swap => dup 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 over tuck => dup 0 over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 0 over + => dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 over * => 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 over bit-and => 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 1, { { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 over bit-or => dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 over bit-xor => dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 over << => 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 1, { { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 over >> => 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 1, { { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 over min => 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 1, { { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 over max => dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 over = => dup !
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 0 over != => dup 1 min
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 0 over < => dup 1 min
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 0 over <= => 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 1, { { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 0 over > => 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 1, { { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 over >= => dup !
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 0 over and => 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 1, { { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 over or => dup 1 min
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 0 over 0 => 0 2dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Push_Int, {}, 0, "0" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" } } } },
+		// 0 2dup rot => dup 0 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 2dup + => 0 over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 0 2dup - => 0 over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 0 2dup * => 0 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 2dup bit-and => 0 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 2dup bit-or => 0 over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 0 2dup bit-xor => 0 over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 0 2dup << => 0 over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 0 2dup >> => 0 over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 0 2dup min => 0 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 2dup max => 0 over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 0 2dup = => 0 over !
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 0 2dup < => 0 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 2dup <= => 0 over !
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 0 2dup >= => 0 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 0 2dup and => 0 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 2dup or => 0 2dup !=
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// 0 2dup ! => 0 over 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 0 2dup 0 => 0 2dup dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Push_Int, {}, 0, "0" } } }, { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 swap drop => drop 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 swap << => drop 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 swap >> => drop 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 swap 0 => 0 tuck
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 0, "0" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" } } } },
+		// 0 rot 2drop => swap drop
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// 0 rot swap => swap 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 rot tuck => swap 0 over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 0 rot + => swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 rot * => swap drop 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 rot bit-and => swap drop 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 rot bit-or => swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 rot bit-xor => swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 rot << => swap drop 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 rot >> => swap drop 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 rot min => swap drop 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 rot max => swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 rot = => swap !
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 0 rot != => swap 1 min
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 0 rot < => swap 1 min
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 0 rot <= => swap drop 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 0 rot > => swap drop 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 rot >= => swap !
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 0 rot and => swap drop 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 0 rot or => swap 1 min
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 0 rot 0 => 0 rot over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Push_Int, {}, 0, "0" } } }, { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 0 tuck + => 0 swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 tuck - => 0 swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract, 0, "-" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 tuck * => drop 0 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 tuck bit-and => drop 0 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 tuck bit-or => 0 swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 tuck bit-xor => 0 swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor, 0, "bit-xor" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 tuck << => 0 swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift, 0, "<<" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 tuck >> => 0 swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 tuck min => drop 0 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 tuck max => 0 swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" } } }, { 2, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 tuck = => ! 0 swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 tuck < => drop 0 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 tuck <= => ! 0 swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 0 tuck >= => drop 0 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 0 tuck and => drop 0 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 tuck or => 0 tuck !=
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal, 0, "!=" } } } },
+		// 0 tuck ! => 0 swap 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 0 tuck 0 => 0 tuck dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Push_Int, {}, 0, "0" } } }, { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 0 2swap rot => rot rot 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 0, "0" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Swap, 0, "2swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 1 over swap => dup 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 1 over tuck => dup 1 over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 1 over * => dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 1 over <= => dup 1 min
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 1 over > => dup !
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 1 over and => dup 1 bit-and
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// 1 over or => 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 1 over 1 => 1 2dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Push_Int, {}, 1, "1" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" } } } },
+		// 1 2dup rot => dup 1 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 1 2dup * => 1 over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 1 2dup < => 1 over !
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 1 2dup >= => 1 2dup min
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 1 2dup and => 1 2dup bit-and
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// 1 2dup or => 1 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 1 2dup ! => 1 over 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 1 2dup 1 => 1 2dup dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Push_Int, {}, 1, "1" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup, 0, "2dup" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 1 swap drop => drop 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 1 swap 1 => 1 tuck
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" } } } },
+		// 1 rot 2drop => swap drop
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" } } } },
+		// 1 rot swap => swap 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 1 rot tuck => swap 1 over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 1 rot * => swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 1 rot <= => swap 1 min
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 1 rot > => swap !
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 1 rot and => swap 1 bit-and
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// 1 rot or => swap drop 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 1 rot 1 => 1 rot over
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Push_Int, {}, 1, "1" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" } } } },
+		// 1 tuck * => 1 swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 1 tuck < => ! 1 swap
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less, 0, "<" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" } } } },
+		// 1 tuck >= => 1 tuck min
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 1 tuck and => 1 tuck bit-and
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// 1 tuck or => drop 1 dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 1 tuck ! => 1 swap 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap, 0, "swap" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 1 tuck 1 => 1 tuck dup
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Push_Int, {}, 1, "1" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck, 0, "tuck" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup, 0, "dup" } } } },
+		// 1 2swap rot => rot rot 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Swap, 0, "2swap" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot, 0, "rot" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 1 + * => over * +
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Add, 0, "+" } } } },
+		// 1 bit-and and => * 1 bit-and
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul, 0, "*" }, { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// 1 bit-or or => 2drop 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 1 bit-or ! => drop 0
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or, 0, "bit-or" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop, 0, "drop" }, { Operation::Kind::Push_Int, {}, 0, "0" } } } },
+		// 1 >> ! => 1 <=
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift, 0, ">>" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 2, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// 1 min >= => ! or
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 1 min and => 1 min bit-and
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And, 0, "and" } } }, { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And, 0, "bit-and" } } } },
+		// 1 min or => or
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } } },
+		// 1 min ! => !
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } }, { 1, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate, 0, "!" } } } },
+		// 1 max >= => over <= min
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq, 0, ">=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Min, 0, "min" } } } },
+		// 1 max or => 2drop 1
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Max, 0, "max" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or, 0, "or" } } }, { 2, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop, 0, "2drop" }, { Operation::Kind::Push_Int, {}, 1, "1" } } } },
+		// 1 = <= => over = <=
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal, 0, "=" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// 1 > <= => over > <=
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq, 0, "<=" } } } },
+		// 1 > > => over > >
+		{ { 3, { { Operation::Kind::Push_Int, {}, 1, "1" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } }, { 3, { { Operation::Kind::Intrinsic, Intrinsic_Kind::Over, 0, "over" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" }, { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater, 0, ">" } } } },
+	};
+
+	std::span<Rule const> const rules = Rules;
+}
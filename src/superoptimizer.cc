@@ -0,0 +1,324 @@
+#include "superoptimizer.hh"
+#include "ssa.hh"
+
+#include <array>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+#include <span>
+
+namespace superoptimizer
+{
+	struct Letter
+	{
+		Rule_Operation op;
+		std::string_view identifier; // name in C++ source
+		std::string_view name;       // name in Stacky source
+		unsigned cost;               // approximate number of instructions emitted by backend
+	};
+
+	// Operations that sequences are built from. Stack depth needed by any sequence must be
+	// lower than number of inputs used for testing.
+	constexpr Letter Alphabet[] = {
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Drop },           "Drop",           "drop",    1 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Drop },       "Two_Drop",       "2drop",   1 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Dup },            "Dup",            "dup",     1 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Over },           "Over",           "over",    1 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Dup },        "Two_Dup",        "2dup",    2 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Over },       "Two_Over",       "2over",   2 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Swap },           "Swap",           "swap",    4 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Rot },            "Rot",            "rot",     4 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Tuck },           "Tuck",           "tuck",    5 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Two_Swap },       "Two_Swap",       "2swap",   6 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Add },            "Add",            "+",       4 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Subtract },       "Subtract",       "-",       4 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Mul },            "Mul",            "*",       4 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_And },    "Bitwise_And",    "bit-and", 4 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Or },     "Bitwise_Or",     "bit-or",  4 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Bitwise_Xor },    "Bitwise_Xor",    "bit-xor", 4 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Left_Shift },     "Left_Shift",     "<<",      5 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Right_Shift },    "Right_Shift",    ">>",      5 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Min },            "Min",            "min",     5 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Max },            "Max",            "max",     5 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Equal },          "Equal",          "=",       6 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Not_Equal },      "Not_Equal",      "!=",      6 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Less },           "Less",           "<",       6 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Less_Eq },        "Less_Eq",        "<=",      6 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater },        "Greater",        ">",       6 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Greater_Eq },     "Greater_Eq",     ">=",      6 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_And },    "Boolean_And",    "and",     7 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Or },     "Boolean_Or",     "or",      7 },
+		{ { Operation::Kind::Intrinsic, Intrinsic_Kind::Boolean_Negate }, "Boolean_Negate", "!",       5 },
+		{ { Operation::Kind::Push_Int, {}, 0 },                           "",               "0",       2 },
+		{ { Operation::Kind::Push_Int, {}, 1 },                           "",               "1",       2 },
+	};
+
+	constexpr unsigned Stack_Depth = 8;
+
+	using Sequence = std::vector<unsigned>; // indexes into alphabet
+	using Inputs = std::array<std::uint64_t, Stack_Depth>;
+
+	auto is_shuffle(Letter const& letter) -> bool
+	{
+		if (letter.op.kind != Operation::Kind::Intrinsic)
+			return false;
+		switch (letter.op.intrinsic) {
+		case Intrinsic_Kind::Drop: case Intrinsic_Kind::Two_Drop: case Intrinsic_Kind::Dup:  case Intrinsic_Kind::Over:
+		case Intrinsic_Kind::Two_Dup: case Intrinsic_Kind::Two_Over: case Intrinsic_Kind::Swap: case Intrinsic_Kind::Rot:
+		case Intrinsic_Kind::Tuck: case Intrinsic_Kind::Two_Swap:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	auto inputs_count(Letter const& letter) -> unsigned
+	{
+		if (letter.op.kind == Operation::Kind::Push_Int)
+			return 0;
+		switch (letter.op.intrinsic) {
+		case Intrinsic_Kind::Drop: case Intrinsic_Kind::Dup: case Intrinsic_Kind::Boolean_Negate:
+			return 1;
+		case Intrinsic_Kind::Rot:
+			return 3;
+		case Intrinsic_Kind::Two_Over: case Intrinsic_Kind::Two_Swap:
+			return 4;
+		default:
+			return 2;
+		}
+	}
+
+	// Evaluates intrinsic on values of given width in bits (power of 2), the same way as generated code does for 64 bits
+	auto evaluate(Intrinsic_Kind intrinsic, std::uint64_t a, std::uint64_t b, unsigned width) -> std::uint64_t
+	{
+		auto const mask = width == 64 ? ~0ull : (1ull << width) - 1;
+		switch (intrinsic) {
+		case Intrinsic_Kind::Left_Shift:
+			return (a << (b & (width - 1))) & mask;
+		case Intrinsic_Kind::Right_Shift:
+			return std::uint64_t((std::int64_t(a << (64 - width)) >> (64 - width)) >> (b & (width - 1))) & mask;
+		default:
+			return *ssa::evaluate(intrinsic, a, b) & mask;
+		}
+	}
+
+	// Executes sequence on the stack of values of given width, fails when it needs more values than stack has
+	auto execute(Sequence const& sequence, std::span<std::uint64_t const> inputs, unsigned width = 64) -> std::optional<std::vector<std::uint64_t>>
+	{
+		std::vector<std::uint64_t> stack(std::cbegin(inputs), std::cend(inputs));
+		for (auto index : sequence) {
+			auto const& letter = Alphabet[index];
+			if (stack.size() < inputs_count(letter))
+				return std::nullopt;
+
+			if (letter.op.kind == Operation::Kind::Push_Int) {
+				stack.push_back(letter.op.ival);
+			} else if (is_shuffle(letter)) {
+				optimizer::apply_stack_shuffle(letter.op.intrinsic, stack);
+			} else if (letter.op.intrinsic == Intrinsic_Kind::Boolean_Negate) {
+				stack.back() = evaluate(letter.op.intrinsic, stack.back(), 0, width);
+			} else {
+				auto const b = stack.back(); stack.pop_back();
+				auto const a = stack.back(); stack.pop_back();
+				stack.push_back(evaluate(letter.op.intrinsic, a, b, width));
+			}
+		}
+		return stack;
+	}
+
+	// Number of values from the stack that sequence uses
+	auto stack_inputs(Sequence const& sequence) -> unsigned
+	{
+		static constexpr Inputs Zeros = {};
+		auto count = 0u;
+		while (!execute(sequence, std::span(Zeros).first(count)))
+			++count;
+		return count;
+	}
+
+	auto cost(Sequence const& sequence) -> unsigned
+	{
+		unsigned total = 0;
+		for (auto index : sequence)
+			total += Alphabet[index].cost;
+		return total;
+	}
+
+	// Inputs with boundary values, repeated values (to distinguish `<` from `<=` and alike)
+	// and booleans (to distinguish `and` from `bit-and`) besides random ones
+	auto test_inputs(unsigned count, std::uint64_t seed) -> std::vector<Inputs>
+	{
+		static constexpr std::uint64_t Interesting[] = { 0, 1, 2, 3, 63, 64, 1ull << 63, ~0ull, ~0ull - 1 };
+
+		std::mt19937_64 rng(seed);
+		std::vector<Inputs> result(count);
+		for (auto &inputs : result) {
+			for (auto i = 0u; i < Stack_Depth; ++i) {
+				switch (rng() % 4) {
+				case 0:  inputs[i] = rng(); break;
+				case 1:  inputs[i] = Interesting[rng() % std::size(Interesting)]; break;
+				case 2:  inputs[i] = i > 0 ? inputs[rng() % i] : rng(); break;
+				default: inputs[i] = rng() % 4; break;
+				}
+			}
+		}
+		return result;
+	}
+
+	// Calls `check` with every stack of `count` values taken from `values`, until it fails
+	auto for_all_stacks(std::span<std::uint64_t const> values, unsigned count, auto &&check) -> bool
+	{
+		std::vector<unsigned> digits(count);
+		std::vector<std::uint64_t> stack(count, values.front());
+		for (;;) {
+			if (!check(std::span<std::uint64_t const>(stack)))
+				return false;
+			auto i = 0u;
+			for (; i < count && ++digits[i] == values.size(); ++i)
+				digits[i] = 0, stack[i] = values.front();
+			if (i == count)
+				return true;
+			stack[i] = values[digits[i]];
+		}
+	}
+
+	// Proves that sequences are equivalent by checking all stacks of values narrowed to few bits,
+	// and all stacks of 64 bit values at edges, where wraparound and sign bit break equivalences
+	// that hold for most values. Random testing alone misses rules like `! or or => ! + or`,
+	// which differ only when one of values has all bits set.
+	auto proven_equivalent(Sequence const& lhs, Sequence const& rhs) -> bool
+	{
+		static constexpr unsigned Max_Narrow_Stacks = 1u << 20;
+		static constexpr std::uint64_t Edges[] = { 0, 1, 1ull << 63, ~0ull - 1, ~0ull };
+
+		auto const count = std::max(stack_inputs(lhs), stack_inputs(rhs));
+
+		auto width = 4u;
+		while (width > 1 && (1ull << (width * count)) > Max_Narrow_Stacks)
+			width /= 2;
+
+		std::vector<std::uint64_t> narrow(1ull << width);
+		std::iota(std::begin(narrow), std::end(narrow), 0ull);
+
+		return for_all_stacks(narrow, count, [&](auto stack) { return execute(lhs, stack, width) == execute(rhs, stack, width); })
+			&& for_all_stacks(Edges, count, [&](auto stack) { return execute(lhs, stack) == execute(rhs, stack); });
+	}
+
+	void print_sequence(std::ostream &out, Sequence const& sequence)
+	{
+		out << "{ " << sequence.size() << ", {";
+		for (auto i = 0u; i < sequence.size(); ++i) {
+			auto const& letter = Alphabet[sequence[i]];
+			out << (i ? ", " : " ");
+			if (letter.op.kind == Operation::Kind::Push_Int)
+				out << "{ Operation::Kind::Push_Int, {}, " << letter.op.ival << ", \"" << letter.name << "\" }";
+			else
+				out << "{ Operation::Kind::Intrinsic, Intrinsic_Kind::" << letter.identifier << ", 0, \"" << letter.name << "\" }";
+		}
+		out << (sequence.empty() ? "} }" : " } }");
+	}
+
+	void generate_rules(std::ostream &out, unsigned max_length)
+	{
+		auto const fingerprint_inputs = test_inputs(64, 1);
+		auto const verification_inputs = test_inputs(4096, 2);
+
+		using Fingerprint = std::vector<std::uint64_t>;
+		auto const fingerprint = [&](Sequence const& sequence) -> std::optional<Fingerprint> {
+			Fingerprint result;
+			for (auto const& inputs : fingerprint_inputs) {
+				auto const stack = execute(sequence, inputs);
+				if (!stack)
+					return std::nullopt;
+				result.push_back(stack->size());
+				result.insert(std::end(result), std::cbegin(*stack), std::cend(*stack));
+			}
+			return result;
+		};
+
+		auto const equivalent = [&](Sequence const& lhs, Sequence const& rhs) {
+			return std::all_of(std::cbegin(verification_inputs), std::cend(verification_inputs), [&](Inputs const& inputs) {
+				return execute(lhs, inputs) == execute(rhs, inputs);
+			}) && proven_equivalent(lhs, rhs);
+		};
+
+		// Cheapest known sequences for each behaviour, one per length
+		std::map<Fingerprint, std::map<unsigned, Sequence>> classes;
+
+		// Sequences that cannot be improved, only those are extended into longer sequences,
+		// since sequence that contains improvable one is improved by the shorter rule
+		std::vector<Sequence> optimal = { {} };
+		classes[*fingerprint({})][0] = {};
+
+		std::vector<std::pair<Sequence, Sequence>> rules;
+
+		ensure_fatal(max_length <= Max_Sequence_Length, std::format("Sequences longer than {} operations are not supported", Max_Sequence_Length));
+
+		for (auto length = 1u; length <= max_length; ++length) {
+			std::vector<std::pair<Sequence, Fingerprint>> candidates;
+			std::set<Sequence> optimal_shorter;
+			for (auto const& sequence : optimal)
+				if (sequence.size() == length - 1)
+					optimal_shorter.insert(sequence);
+
+			for (auto const& prefix : optimal_shorter) {
+				for (auto letter = 0u; letter < std::size(Alphabet); ++letter) {
+					auto sequence = prefix;
+					sequence.push_back(letter);
+					if (!optimal_shorter.contains(Sequence(std::cbegin(sequence) + 1, std::cend(sequence))))
+						continue;
+					if (auto print = fingerprint(sequence)) {
+						auto &best = classes[*print][length];
+						if (best.empty() || cost(sequence) < cost(best))
+							best = sequence;
+						candidates.emplace_back(std::move(sequence), *std::move(print));
+					}
+				}
+			}
+
+			for (auto const& [sequence, print] : candidates) {
+				std::optional<Sequence> replacement = std::nullopt;
+				for (auto const& [replacement_length, candidate] : classes[print]) {
+					if (replacement_length > length || cost(candidate) >= cost(sequence))
+						continue;
+					if (replacement && cost(*replacement) <= cost(candidate))
+						continue;
+					if (equivalent(sequence, candidate))
+						replacement = candidate;
+				}
+
+				if (!replacement) {
+					optimal.push_back(sequence);
+					continue;
+				}
+
+				// Runs of stack manipulations are already minimized by optimizer
+				// and sequences without inputs are computed by constant folding
+				if (std::all_of(std::cbegin(sequence), std::cend(sequence), [](unsigned i) { return is_shuffle(Alphabet[i]); }))
+					continue;
+				if (stack_inputs(sequence) > 0)
+					rules.emplace_back(sequence, *replacement);
+			}
+		}
+
+		out << "// Generated by `stacky superopt --length " << max_length << "`, do not edit.\n";
+		out << "#include \"superoptimizer.hh\"\n\n";
+		out << "namespace superoptimizer\n{\n";
+		out << "\tconstexpr Rule Rules[] = {\n";
+		for (auto const& [pattern, replacement] : rules) {
+			out << "\t\t// ";
+			for (auto i : pattern) out << Alphabet[i].name << ' ';
+			out << "=>";
+			for (auto i : replacement) out << ' ' << Alphabet[i].name;
+			out << "\n\t\t{ ";
+			print_sequence(out, pattern);
+			out << ", ";
+			print_sequence(out, replacement);
+			out << " },\n";
+		}
+		out << "\t};\n\n";
+		out << "\tstd::span<Rule const> const rules = Rules;\n";
+		out << "}\n";
+	}
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "stacky.hh"
+
+#include <span>
+
+// Rewrite rules for short sequences of operations, found offline by `stacky superopt`
+// which enumerates sequences and searches for cheaper equivalents.
+namespace superoptimizer
+{
+	struct Rule_Operation
+	{
+		Operation::Kind kind;
+		Intrinsic_Kind intrinsic{};
+		std::uint64_t ival = 0; // value of pushed integer
+		std::string_view name = {};
+	};
+
+	constexpr unsigned Max_Sequence_Length = 4;
+
+	struct Rule_Sequence
+	{
+		unsigned length;
+		Rule_Operation operations[Max_Sequence_Length];
+
+		auto begin() const { return std::cbegin(operations); }
+		auto end()   const { return std::cbegin(operations) + length; }
+	};
+
+	struct Rule
+	{
+		Rule_Sequence pattern;
+		Rule_Sequence replacement;
+	};
+
+	// Generated table, see src/superoptimizer-rules.cc
+	extern std::span<Rule const> const rules;
+
+	// Writes C++ source of rules table for all sequences up to given length
+	void generate_rules(std::ostream &out, unsigned max_length);
+}
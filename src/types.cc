@@ -78,9 +78,10 @@ auto join(std::ranges::forward_range auto&& range, std::string_view sep)
 	auto const end_it = std::ranges::end(range);
 	for (auto it = std::ranges::begin(range);;) {
 		s += std::format("{}", *it);
-		if (++it != end_it) {
-			s += sep;
+		if (++it == end_it) {
+			break;
 		}
+		s += sep;
 	}
 	return s;
 }
@@ -562,6 +563,23 @@ void typecheck(
 					Typecheck_Stack_Effect(s, _1 >= _1 >> Ptr);
 					break;
 
+				case Intrinsic_Kind::Memory_Copy:
+				case Intrinsic_Kind::Memory_Move:
+					Typecheck_Stack_Effect(s, Ptr >> Ptr >> Int >= Empty);
+					break;
+
+				case Intrinsic_Kind::Memory_Set:
+					Typecheck_Stack_Effect(s, Ptr >> Int >> Int >= Empty);
+					break;
+
+				case Intrinsic_Kind::Memory_Compare:
+					Typecheck_Stack_Effect(s, Ptr >> Ptr >> Int >= Int);
+					break;
+
+				case Intrinsic_Kind::Memory_Find:
+					Typecheck_Stack_Effect(s, Ptr >> Int >> Int >= Ptr);
+					break;
+
 				case Intrinsic_Kind::Syscall:
 					{
 						assert(op.token.sval.size() == 8 && op.token.sval[7] >= '0' && op.token.sval[7] <= '6');
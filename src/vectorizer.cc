@@ -0,0 +1,807 @@
+#include "vectorizer.hh"
+#include "arguments.hh"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+namespace vectorizer
+{
+	// Values of body of scalar loop, computed by following it with stack of terms
+	struct Term
+	{
+		enum class Kind
+		{
+			Counter,
+			Parameter,
+			Constant,
+			Symbol,
+			Load,
+			Intrinsic,
+			Select,
+		};
+
+		Kind kind;
+		Intrinsic_Kind intrinsic{};
+		std::uint64_t value = 0; // constant, depth of parameter, symbol id or size of load
+		std::string_view symbol_prefix = {};
+		std::vector<unsigned> inputs = {};
+	};
+
+	// Address of the form `base + counter * scale + offset`, where base is symbol or parameter
+	struct Address
+	{
+		std::optional<std::pair<std::string_view, std::uint64_t>> symbol = std::nullopt;
+		std::optional<unsigned> parameter = std::nullopt;
+		std::uint64_t scale = 0;
+		std::int64_t offset = 0;
+
+		auto has_base() const -> bool { return symbol || parameter; }
+		auto same_base(Address const& other) const -> bool { return symbol == other.symbol && parameter == other.parameter; }
+	};
+
+	struct Traced_Store
+	{
+		Address address;
+		unsigned size;
+		unsigned value;
+	};
+
+	// Size in bytes of `loadN` or `storeN`
+	auto access_size(Operation const& op) -> unsigned
+	{
+		switch (op.token.sval[op.intrinsic == Intrinsic_Kind::Load ? 4 : 5]) {
+		case '8': return 1;
+		case '1': return 2;
+		case '3': return 4;
+		default:  return 8;
+		}
+	}
+
+	struct Tracer
+	{
+		// Values deeper than that cannot be used by loop body
+		static constexpr unsigned Max_Parameters = 8;
+
+		std::vector<Operation> const& body;
+		std::vector<Term> terms = {};
+		std::vector<unsigned> stack = {};
+		std::vector<Traced_Store> stores = {};
+		std::vector<unsigned> load_sizes = {};
+		bool failed = false;
+
+		auto add(Term term) -> unsigned
+		{
+			terms.push_back(std::move(term));
+			return terms.size() - 1;
+		}
+
+		auto pop() -> unsigned
+		{
+			if (stack.empty()) {
+				failed = true;
+				return 0;
+			}
+			auto const top = stack.back();
+			stack.pop_back();
+			return top;
+		}
+
+		auto same(unsigned a, unsigned b) const -> bool
+		{
+			if (a == b)
+				return true;
+			auto const& x = terms[a], &y = terms[b];
+			if (x.kind != y.kind || x.intrinsic != y.intrinsic || x.value != y.value || x.symbol_prefix != y.symbol_prefix || x.inputs.size() != y.inputs.size())
+				return false;
+			// Counter and parameters are the same only as the same term
+			if (x.kind == Term::Kind::Counter || x.kind == Term::Kind::Parameter)
+				return false;
+			for (auto i = 0u; i < x.inputs.size(); ++i)
+				if (!same(x.inputs[i], y.inputs[i]))
+					return false;
+			return true;
+		}
+
+		auto address(unsigned t) const -> std::optional<Address>
+		{
+			auto const& term = terms[t];
+			auto const constant = [&](unsigned input) -> std::optional<std::uint64_t> {
+				auto const& operand = terms[term.inputs[input]];
+				return operand.kind == Term::Kind::Constant ? std::optional(operand.value) : std::nullopt;
+			};
+			auto const scaled = [&](unsigned input, std::uint64_t factor) -> std::optional<Address> {
+				auto a = address(term.inputs[input]);
+				if (!a || a->has_base())
+					return std::nullopt;
+				a->scale *= factor;
+				a->offset *= factor;
+				return a;
+			};
+
+			switch (term.kind) {
+			case Term::Kind::Counter:   return Address { .scale = 1 };
+			case Term::Kind::Constant:  return Address { .offset = std::int64_t(term.value) };
+			case Term::Kind::Symbol:    return Address { .symbol = std::pair { term.symbol_prefix, term.value } };
+			case Term::Kind::Parameter: return Address { .parameter = unsigned(term.value) };
+			case Term::Kind::Intrinsic:
+				break;
+			default:
+				return std::nullopt;
+			}
+
+			switch (term.intrinsic) {
+			case Intrinsic_Kind::Add:
+			case Intrinsic_Kind::Subtract:
+				{
+					auto a = address(term.inputs[0]);
+					auto const b = address(term.inputs[1]);
+					if (!a || !b || (a->has_base() && b->has_base()))
+						return std::nullopt;
+					if (term.intrinsic == Intrinsic_Kind::Subtract) {
+						if (b->has_base() || b->scale)
+							return std::nullopt;
+						a->offset -= b->offset;
+						return a;
+					}
+					if (b->has_base())
+						a->symbol = b->symbol, a->parameter = b->parameter;
+					a->scale += b->scale;
+					a->offset += b->offset;
+					return a;
+				}
+			case Intrinsic_Kind::Mul:
+				if (auto const c = constant(1))
+					return scaled(0, *c);
+				if (auto const c = constant(0))
+					return scaled(1, *c);
+				return std::nullopt;
+			case Intrinsic_Kind::Left_Shift:
+				if (auto const c = constant(1); c && *c < 64)
+					return scaled(0, std::uint64_t(1) << *c);
+				return std::nullopt;
+			default:
+				return std::nullopt;
+			}
+		}
+
+		void trace_intrinsic(Operation const& op)
+		{
+			if (op.intrinsic >= Intrinsic_Kind::Drop && op.intrinsic <= Intrinsic_Kind::Two_Swap) {
+				auto const inputs = op.intrinsic == Intrinsic_Kind::Drop || op.intrinsic == Intrinsic_Kind::Dup ? 1u
+					: op.intrinsic == Intrinsic_Kind::Rot ? 3u
+					: op.intrinsic == Intrinsic_Kind::Two_Over || op.intrinsic == Intrinsic_Kind::Two_Swap ? 4u : 2u;
+				if (stack.size() < inputs) {
+					failed = true;
+					return;
+				}
+				optimizer::apply_stack_shuffle(op.intrinsic, stack);
+				return;
+			}
+
+			switch (op.intrinsic) {
+			case Intrinsic_Kind::Load:
+				{
+					// Earlier stores may change loaded value, unless they are to other arrays
+					auto const pointer = pop();
+					auto const a = address(pointer);
+					if (failed || !a || std::any_of(std::cbegin(stores), std::cend(stores), [&](Traced_Store const& store) {
+								return !a->symbol || !store.address.symbol || a->symbol == store.address.symbol;
+							})) {
+						failed = true;
+						return;
+					}
+					load_sizes.push_back(access_size(op));
+					stack.push_back(add({ .kind = Term::Kind::Load, .value = access_size(op), .inputs = { pointer } }));
+				}
+				return;
+
+			case Intrinsic_Kind::Store:
+				{
+					auto const value = pop();
+					auto const a = address(pop());
+					if (failed || !a) {
+						failed = true;
+						return;
+					}
+					stores.push_back({ *a, access_size(op), value });
+				}
+				return;
+
+			case Intrinsic_Kind::Boolean_Negate:
+				{
+					auto const x = pop();
+					stack.push_back(add({ .kind = Term::Kind::Intrinsic, .intrinsic = op.intrinsic, .inputs = { x } }));
+				}
+				return;
+
+			case Intrinsic_Kind::Add:
+			case Intrinsic_Kind::Subtract:
+			case Intrinsic_Kind::Mul:
+			case Intrinsic_Kind::Bitwise_And:
+			case Intrinsic_Kind::Bitwise_Or:
+			case Intrinsic_Kind::Bitwise_Xor:
+			case Intrinsic_Kind::Boolean_And:
+			case Intrinsic_Kind::Boolean_Or:
+			case Intrinsic_Kind::Left_Shift:
+			case Intrinsic_Kind::Right_Shift:
+			case Intrinsic_Kind::Equal:
+			case Intrinsic_Kind::Not_Equal:
+			case Intrinsic_Kind::Less:
+			case Intrinsic_Kind::Less_Eq:
+			case Intrinsic_Kind::Greater:
+			case Intrinsic_Kind::Greater_Eq:
+			case Intrinsic_Kind::Min:
+			case Intrinsic_Kind::Max:
+				{
+					auto const y = pop();
+					auto const x = pop();
+					stack.push_back(add({ .kind = Term::Kind::Intrinsic, .intrinsic = op.intrinsic, .inputs = { x, y } }));
+				}
+				return;
+
+			default:
+				failed = true;
+			}
+		}
+
+		// Branches of `if` are followed separately, values and stores that differ between them are selected by condition
+		auto trace_if(unsigned i) -> unsigned
+		{
+			auto const& op = body[i];
+			auto const condition = pop();
+			auto const has_else = body[op.jump - 1].kind == Operation::Kind::Else;
+			auto const end = has_else ? body[op.jump - 1].jump : op.jump;
+
+			auto const before = stack;
+			auto const first_store = stores.size();
+			trace(i + 1, has_else ? op.jump - 1 : end);
+			auto const then_stack = std::exchange(stack, before);
+			std::vector<Traced_Store> const then_stores(std::begin(stores) + first_store, std::end(stores));
+			stores.resize(first_store);
+			if (has_else)
+				trace(op.jump, end);
+			std::vector<Traced_Store> const else_stores(std::begin(stores) + first_store, std::end(stores));
+			stores.resize(first_store);
+
+			if (failed || then_stack.size() != stack.size() || then_stores.size() != else_stores.size()) {
+				failed = true;
+				return end;
+			}
+
+			auto const select = [&](unsigned when_true, unsigned when_false) {
+				if (same(when_true, when_false))
+					return when_true;
+				return add({ .kind = Term::Kind::Select, .inputs = { condition, when_true, when_false } });
+			};
+
+			for (auto k = 0u; k < stack.size(); ++k)
+				stack[k] = select(then_stack[k], stack[k]);
+
+			for (auto k = 0u; k < then_stores.size(); ++k) {
+				auto const& a = then_stores[k], &b = else_stores[k];
+				if (a.size != b.size || !a.address.same_base(b.address) || a.address.scale != b.address.scale || a.address.offset != b.address.offset) {
+					failed = true;
+					return end;
+				}
+				stores.push_back({ a.address, a.size, select(a.value, b.value) });
+			}
+			return end;
+		}
+
+		void trace(unsigned first, unsigned last)
+		{
+			for (auto i = first; i < last && !failed; ++i) {
+				auto const& op = body[i];
+				switch (op.kind) {
+				case Operation::Kind::Push_Int:
+					stack.push_back(add({ .kind = Term::Kind::Constant, .value = op.ival }));
+					break;
+				case Operation::Kind::Push_Symbol:
+					stack.push_back(add({ .kind = Term::Kind::Symbol, .value = op.ival, .symbol_prefix = op.symbol_prefix }));
+					break;
+				case Operation::Kind::Cast:
+					break;
+				case Operation::Kind::Intrinsic:
+					trace_intrinsic(op);
+					break;
+				case Operation::Kind::If:
+					i = trace_if(i);
+					break;
+				default:
+					failed = true;
+				}
+			}
+		}
+	};
+
+	// Translation of terms into nodes computed in lanes. Value in lane is either exactly the value
+	// of scalar loop (like loaded element), or only its lowest bits (like sum of elements), which is
+	// enough for stores, but not for comparisons or shifts to the right. Conditions are masks.
+	struct Lowering
+	{
+		enum class Form { Exact, Wrapped, Mask };
+		using Lowered = std::optional<std::pair<unsigned, Form>>;
+
+		Tracer const& tracer;
+		Loop &loop;
+		std::set<unsigned> reduced = {}; // depths of parameters that change in every iteration
+		std::unordered_map<unsigned, Lowered> lowered = {};
+		std::optional<unsigned> zero = std::nullopt;
+
+		auto node(Node node, Form form) -> Lowered
+		{
+			loop.nodes.push_back(std::move(node));
+			return std::pair { unsigned(loop.nodes.size() - 1), form };
+		}
+
+		auto constant(std::uint64_t value) -> Lowered
+		{
+			auto const bits = 8 * loop.element_size;
+			return node({ .kind = Node::Kind::Constant, .value = value }, value >> bits == 0 ? Form::Exact : Form::Wrapped);
+		}
+
+		// Masks become 0 or 1 as `0 - mask`
+		auto value(Lowered x) -> Lowered
+		{
+			if (!x || x->second != Form::Mask)
+				return x;
+			if (!zero)
+				zero = constant(0)->first;
+			return node({ .kind = Node::Kind::Intrinsic, .intrinsic = Intrinsic_Kind::Subtract, .inputs = { *zero, x->first } }, Form::Exact);
+		}
+
+		// Values become masks of lanes that are not zero, which is known only for exact values
+		auto mask(Lowered x) -> Lowered
+		{
+			if (!x || x->second == Form::Mask)
+				return x;
+			if (x->second != Form::Exact)
+				return std::nullopt;
+			if (!zero)
+				zero = constant(0)->first;
+			return node({ .kind = Node::Kind::Intrinsic, .intrinsic = Intrinsic_Kind::Not_Equal, .inputs = { x->first, *zero } }, Form::Mask);
+		}
+
+		// Shift by constant, bytes are shifted as words and bits that came from the other byte are cleared
+		auto shift(Intrinsic_Kind kind, Lowered x, std::uint64_t amount, Form form) -> Lowered
+		{
+			if (!x || amount >= 8 * loop.element_size)
+				return std::nullopt;
+			Node shifted { .kind = Node::Kind::Intrinsic, .intrinsic = kind, .value = amount, .inputs = { x->first } };
+			if (loop.element_size == 1)
+				shifted.inputs.push_back(constant(kind == Intrinsic_Kind::Left_Shift ? (0xff << amount) & 0xff : 0xff >> amount)->first);
+			return node(std::move(shifted), form);
+		}
+
+		auto lower(unsigned t) -> Lowered
+		{
+			if (auto const it = lowered.find(t); it != std::end(lowered))
+				return it->second;
+			auto const result = lower_term(t);
+			lowered.insert({ t, result });
+			return result;
+		}
+
+		auto lower_term(unsigned t) -> Lowered
+		{
+			auto const& term = tracer.terms[t];
+			switch (term.kind) {
+			case Term::Kind::Counter:
+			case Term::Kind::Symbol:
+				return std::nullopt;
+
+			case Term::Kind::Constant:
+				return constant(term.value);
+
+			case Term::Kind::Parameter:
+				if (reduced.contains(term.value))
+					return std::nullopt;
+				return node({ .kind = Node::Kind::Parameter, .value = term.value }, Form::Wrapped);
+
+			case Term::Kind::Load:
+				{
+					auto const a = tracer.address(term.inputs[0]);
+					if (!a || !a->symbol || a->scale != loop.element_size || term.value != loop.element_size)
+						return std::nullopt;
+					// Element that is stored by earlier iteration cannot be loaded ahead of it
+					for (auto const& store : loop.stores)
+						if (store.symbol_prefix == a->symbol->first && store.symbol == a->symbol->second && a->offset < store.offset)
+							return std::nullopt;
+					return node({ .kind = Node::Kind::Load, .value = a->symbol->second, .symbol_prefix = a->symbol->first, .offset = a->offset }, Form::Exact);
+				}
+
+			case Term::Kind::Select:
+				{
+					auto const condition = mask(lower(term.inputs[0]));
+					auto const when_true = value(lower(term.inputs[1]));
+					auto const when_false = value(lower(term.inputs[2]));
+					if (!condition || !when_true || !when_false)
+						return std::nullopt;
+					auto const form = when_true->second == Form::Exact && when_false->second == Form::Exact ? Form::Exact : Form::Wrapped;
+					return node({ .kind = Node::Kind::Select, .inputs = { condition->first, when_true->first, when_false->first } }, form);
+				}
+
+			case Term::Kind::Intrinsic:
+				break;
+			}
+
+			auto const constant_input = [&](unsigned input) -> std::optional<std::uint64_t> {
+				auto const& operand = tracer.terms[term.inputs[input]];
+				return operand.kind == Term::Kind::Constant ? std::optional(operand.value) : std::nullopt;
+			};
+
+			if (term.intrinsic == Intrinsic_Kind::Boolean_Negate) {
+				auto const x = lower(term.inputs[0]);
+				if (!x)
+					return std::nullopt;
+				if (x->second == Form::Mask)
+					return node({ .kind = Node::Kind::Intrinsic, .intrinsic = Intrinsic_Kind::Boolean_Negate, .inputs = { x->first } }, Form::Mask);
+				if (x->second != Form::Exact)
+					return std::nullopt;
+				auto const zero = constant(0);
+				return node({ .kind = Node::Kind::Intrinsic, .intrinsic = Intrinsic_Kind::Equal, .inputs = { x->first, zero->first } }, Form::Mask);
+			}
+
+			switch (term.intrinsic) {
+			case Intrinsic_Kind::Mul:
+				for (auto input = 0u; input < 2; ++input)
+					if (auto const c = constant_input(input); c && std::has_single_bit(*c))
+						return shift(Intrinsic_Kind::Left_Shift, value(lower(term.inputs[1 - input])), std::countr_zero(*c), Form::Wrapped);
+				return std::nullopt;
+
+			case Intrinsic_Kind::Left_Shift:
+			case Intrinsic_Kind::Right_Shift:
+				{
+					auto const amount = constant_input(1);
+					auto const x = value(lower(term.inputs[0]));
+					if (!amount || !x)
+						return std::nullopt;
+					if (term.intrinsic == Intrinsic_Kind::Left_Shift)
+						return shift(term.intrinsic, x, *amount, Form::Wrapped);
+					if (x->second != Form::Exact)
+						return std::nullopt;
+					return shift(term.intrinsic, x, *amount, Form::Exact);
+				}
+
+			default:
+				break;
+			}
+
+			auto x = lower(term.inputs[0]);
+			auto y = lower(term.inputs[1]);
+			if (!x || !y)
+				return std::nullopt;
+
+			auto const intrinsic = [&](Intrinsic_Kind kind, Lowered a, Lowered b, Form form) -> Lowered {
+				if (!a || !b)
+					return std::nullopt;
+				return node({ .kind = Node::Kind::Intrinsic, .intrinsic = kind, .inputs = { a->first, b->first } }, form);
+			};
+			auto const exact = [](Lowered a) { return a && a->second == Form::Exact; };
+
+			switch (term.intrinsic) {
+			case Intrinsic_Kind::Add:
+			case Intrinsic_Kind::Subtract:
+				return intrinsic(term.intrinsic, value(x), value(y), Form::Wrapped);
+
+			case Intrinsic_Kind::Bitwise_And:
+				x = value(x), y = value(y);
+				return intrinsic(term.intrinsic, x, y, exact(x) || exact(y) ? Form::Exact : Form::Wrapped);
+
+			case Intrinsic_Kind::Bitwise_Or:
+			case Intrinsic_Kind::Bitwise_Xor:
+				x = value(x), y = value(y);
+				return intrinsic(term.intrinsic, x, y, exact(x) && exact(y) ? Form::Exact : Form::Wrapped);
+
+			case Intrinsic_Kind::Equal:
+			case Intrinsic_Kind::Not_Equal:
+			case Intrinsic_Kind::Less:
+			case Intrinsic_Kind::Less_Eq:
+			case Intrinsic_Kind::Greater:
+			case Intrinsic_Kind::Greater_Eq:
+				x = value(x), y = value(y);
+				if (!exact(x) || !exact(y))
+					return std::nullopt;
+				return intrinsic(term.intrinsic, x, y, Form::Mask);
+
+			case Intrinsic_Kind::Min:
+			case Intrinsic_Kind::Max:
+				// Unsigned minimum of double words requires SSE4.1
+				x = value(x), y = value(y);
+				if (!exact(x) || !exact(y) || (loop.element_size == 4 && !compiler_arguments.avx2))
+					return std::nullopt;
+				return intrinsic(term.intrinsic, x, y, Form::Exact);
+
+			// `and` and `or` check whether result of bitwise operation is nonzero
+			case Intrinsic_Kind::Boolean_And:
+				if (x->second == Form::Mask && y->second == Form::Mask)
+					return intrinsic(term.intrinsic, x, y, Form::Mask);
+				x = value(x), y = value(y);
+				return mask(intrinsic(Intrinsic_Kind::Bitwise_And, x, y, exact(x) || exact(y) ? Form::Exact : Form::Wrapped));
+
+			case Intrinsic_Kind::Boolean_Or:
+				if (x->second == Form::Mask && y->second == Form::Mask)
+					return intrinsic(term.intrinsic, x, y, Form::Mask);
+				x = value(x), y = value(y);
+				if (!exact(x) || !exact(y))
+					return std::nullopt;
+				return mask(intrinsic(Intrinsic_Kind::Bitwise_Or, x, y, Form::Exact));
+
+			default:
+				return std::nullopt;
+			}
+		}
+	};
+
+	auto analyze(std::vector<Operation> const& body, unsigned while_op) -> std::optional<Loop>
+	{
+		// Vector loop is added to scalar one, so code only grows
+		if (compiler_arguments.optimize_size)
+			return std::nullopt;
+
+		auto const is_intrinsic = [&](unsigned i, Intrinsic_Kind kind) {
+			return i < body.size() && body[i].kind == Operation::Kind::Intrinsic && body[i].intrinsic == kind;
+		};
+
+		// while dup N < do ... end
+		auto const do_op = while_op + 4;
+		if (do_op >= body.size() || !is_intrinsic(while_op + 1, Intrinsic_Kind::Dup) || body[while_op + 2].kind != Operation::Kind::Push_Int
+			|| !(is_intrinsic(while_op + 3, Intrinsic_Kind::Less) || is_intrinsic(while_op + 3, Intrinsic_Kind::Not_Equal))
+			|| body[do_op].kind != Operation::Kind::Do)
+			return std::nullopt;
+		auto const end = body[do_op].jump - 1;
+
+		Tracer tracer { .body = body };
+		for (auto depth = Tracer::Max_Parameters; depth > 0; --depth)
+			tracer.stack.push_back(tracer.add({ .kind = Term::Kind::Parameter, .value = depth }));
+		auto const counter = tracer.add({ .kind = Term::Kind::Counter });
+		tracer.stack.push_back(counter);
+		auto const parameters = tracer.stack;
+
+		tracer.trace(do_op + 1, end);
+		if (tracer.failed || tracer.stack.size() != parameters.size())
+			return std::nullopt;
+
+		// Counter goes up by one
+		auto const& next = tracer.terms[tracer.stack.back()];
+		auto const is_one = [&](unsigned t) { return tracer.terms[t].kind == Term::Kind::Constant && tracer.terms[t].value == 1; };
+		if (next.kind != Term::Kind::Intrinsic || next.intrinsic != Intrinsic_Kind::Add
+			|| !((next.inputs[0] == counter && is_one(next.inputs[1])) || (next.inputs[1] == counter && is_one(next.inputs[0]))))
+			return std::nullopt;
+
+		// Values below counter stay the same or have something added to them
+		Loop loop;
+		std::vector<std::pair<unsigned, unsigned>> sums; // depth, term that is added
+		for (auto k = 0u; k + 1 < parameters.size(); ++k) {
+			auto const depth = unsigned(parameters.size() - 1 - k);
+			auto const t = tracer.stack[k];
+			if (t == parameters[k])
+				continue;
+			auto const& term = tracer.terms[t];
+			if (term.kind != Term::Kind::Intrinsic || term.intrinsic != Intrinsic_Kind::Add)
+				return std::nullopt;
+			if (term.inputs[0] == parameters[k])
+				sums.emplace_back(depth, term.inputs[1]);
+			else if (term.inputs[1] == parameters[k])
+				sums.emplace_back(depth, term.inputs[0]);
+			else
+				return std::nullopt;
+		}
+		if (sums.size() > Max_Reductions)
+			return std::nullopt;
+
+		// All elements have the same size
+		std::vector<unsigned> sizes = tracer.load_sizes;
+		for (auto const& store : tracer.stores)
+			sizes.push_back(store.size);
+		if (sizes.empty() || std::adjacent_find(std::cbegin(sizes), std::cend(sizes), std::not_equal_to<>{}) != std::cend(sizes))
+			return std::nullopt;
+		if (sizes.front() != 1 && sizes.front() != 4)
+			return std::nullopt;
+
+		loop.element_size = sizes.front();
+		loop.lanes = (compiler_arguments.avx2 ? 32 : 16) / loop.element_size;
+		loop.bound = body[while_op + 2].ival;
+		if (loop.bound < loop.lanes)
+			return std::nullopt;
+
+		// Each array is stored at most once, so that order of stores between iterations does not matter
+		for (auto const& store : tracer.stores) {
+			if (!store.address.symbol || store.address.scale != loop.element_size)
+				return std::nullopt;
+			for (auto const& other : loop.stores)
+				if (other.symbol_prefix == store.address.symbol->first && other.symbol == store.address.symbol->second)
+					return std::nullopt;
+			loop.stores.push_back({ store.address.symbol->second, store.address.symbol->first, store.address.offset, 0 });
+		}
+
+		Lowering lowering { .tracer = tracer, .loop = loop };
+		for (auto const& [depth, t] : sums)
+			lowering.reduced.insert(depth);
+
+		for (auto k = 0u; k < tracer.stores.size(); ++k) {
+			auto const value = lowering.value(lowering.lower(tracer.stores[k].value));
+			if (!value)
+				return std::nullopt;
+			loop.stores[k].value = value->first;
+		}
+
+		// Sum is computed from values of lanes, which must be the same as values of scalar loop
+		for (auto const& [depth, t] : sums) {
+			auto const value = lowering.value(lowering.lower(t));
+			if (!value || value->second != Lowering::Form::Exact)
+				return std::nullopt;
+			loop.reductions.push_back({ depth, value->first });
+		}
+
+		if (loop.nodes.size() > Max_Nodes)
+			return std::nullopt;
+		return loop;
+	}
+
+	auto recognize_idiom(std::vector<Operation> const& body, unsigned while_op) -> std::optional<Idiom>
+	{
+		if (compiler_arguments.optimize_size)
+			return std::nullopt;
+
+		auto do_op = while_op + 1;
+		for (; do_op < body.size() && body[do_op].kind != Operation::Kind::Do; ++do_op)
+			if (body[do_op].kind != Operation::Kind::Intrinsic && body[do_op].kind != Operation::Kind::Push_Int
+					&& body[do_op].kind != Operation::Kind::Push_Symbol && body[do_op].kind != Operation::Kind::Cast)
+				return std::nullopt;
+		if (do_op >= body.size())
+			return std::nullopt;
+		auto const end = body[do_op].jump - 1;
+
+		Tracer tracer { .body = body };
+		for (auto depth = Tracer::Max_Parameters; depth > 0; --depth)
+			tracer.stack.push_back(tracer.add({ .kind = Term::Kind::Parameter, .value = depth }));
+		auto const counter = tracer.add({ .kind = Term::Kind::Counter });
+		tracer.stack.push_back(counter);
+		auto const parameters = tracer.stack;
+
+		tracer.trace(while_op + 1, do_op);
+		auto const condition = tracer.pop();
+		if (tracer.failed || tracer.stack != parameters || !tracer.stores.empty())
+			return std::nullopt;
+		auto const condition_loads = tracer.load_sizes.size();
+		tracer.trace(do_op + 1, end);
+		if (tracer.failed || tracer.stack.size() != parameters.size())
+			return std::nullopt;
+
+		auto const& terms = tracer.terms;
+		auto const is = [&](unsigned t, Intrinsic_Kind kind) {
+			return terms[t].kind == Term::Kind::Intrinsic && terms[t].intrinsic == kind;
+		};
+		auto const is_constant = [&](unsigned t, std::uint64_t value) {
+			return terms[t].kind == Term::Kind::Constant && terms[t].value == value;
+		};
+
+		// Only counter (and for compare value below it) go up by one
+		auto const incremented = [&](unsigned k) {
+			auto const t = tracer.stack[parameters.size() - 1 - k];
+			return is(t, Intrinsic_Kind::Add)
+				&& ((terms[t].inputs[0] == parameters[parameters.size() - 1 - k] && is_constant(terms[t].inputs[1], 1))
+				 || (terms[t].inputs[1] == parameters[parameters.size() - 1 - k] && is_constant(terms[t].inputs[0], 1)));
+		};
+		auto const only_incremented = [&](unsigned count) {
+			for (auto k = 0u; k < parameters.size(); ++k)
+				if (k < count ? !incremented(k) : tracer.stack[parameters.size() - 1 - k] != parameters[parameters.size() - 1 - k])
+					return false;
+			return true;
+		};
+
+		// Byte loaded from counter or value at depth 1, when it is used directly as a pointer
+		auto const loaded_byte = [&](unsigned t) -> std::optional<unsigned> {
+			if (terms[t].kind != Term::Kind::Load || terms[t].value != 1)
+				return std::nullopt;
+			auto const a = tracer.address(terms[t].inputs[0]);
+			if (!a || a->offset != 0 || a->symbol)
+				return std::nullopt;
+			if (!a->parameter && a->scale == 1)
+				return 0;
+			if (a->parameter == 1u && a->scale == 0)
+				return 1;
+			return std::nullopt;
+		};
+
+		// Term `x` when given one is `x != 0`, `x 0 = !`, or `x 1 min` and `x 0 >` that superoptimizer prefers
+		auto const tested = [&](unsigned t) -> std::optional<unsigned> {
+			if (is(t, Intrinsic_Kind::Not_Equal) || is(t, Intrinsic_Kind::Greater) || is(t, Intrinsic_Kind::Min)) {
+				auto const constant = is(t, Intrinsic_Kind::Min) ? 1 : 0;
+				if (is_constant(terms[t].inputs[1], constant)) return terms[t].inputs[0];
+				if (!is(t, Intrinsic_Kind::Greater) && is_constant(terms[t].inputs[0], constant)) return terms[t].inputs[1];
+			}
+			if (is(t, Intrinsic_Kind::Less) && is_constant(terms[t].inputs[0], 0))
+				return terms[t].inputs[1];
+			if (is(t, Intrinsic_Kind::Boolean_Negate) && is(terms[t].inputs[0], Intrinsic_Kind::Equal)) {
+				auto const& equal = terms[terms[t].inputs[0]];
+				if (is_constant(equal.inputs[1], 0)) return equal.inputs[0];
+				if (is_constant(equal.inputs[0], 0)) return equal.inputs[1];
+			}
+			return std::nullopt;
+		};
+
+		if (tracer.stores.empty()) {
+			auto const byte = loaded_byte(tested(condition).value_or(condition));
+			if (byte == 0u && condition_loads == 1 && tracer.load_sizes.size() == 1 && only_incremented(1))
+				return Idiom { .kind = Idiom::Kind::Length };
+
+			// Both operands of `and` are 0 or 1, so it is logical and
+			if ((is(condition, Intrinsic_Kind::Boolean_And) || is(condition, Intrinsic_Kind::Bitwise_And)) && condition_loads == tracer.load_sizes.size() && only_incremented(2)) {
+				for (auto k = 0u; k < 2; ++k) {
+					auto const equal = terms[condition].inputs[k];
+					auto const nonzero = tested(terms[condition].inputs[1 - k]);
+					if (!nonzero || !loaded_byte(*nonzero) || !is(equal, Intrinsic_Kind::Equal))
+						continue;
+					auto const lhs = loaded_byte(terms[equal].inputs[0]), rhs = loaded_byte(terms[equal].inputs[1]);
+					if (lhs && rhs && *lhs != *rhs)
+						return Idiom { .kind = Idiom::Kind::Compare };
+				}
+			}
+		}
+
+		// Remaining idioms are counted loops storing bytes, counter is index of both arrays
+		if (tracer.stores.size() != 1 || !only_incremented(1))
+			return std::nullopt;
+
+		auto const operand = [&](unsigned t) -> std::optional<Operand> {
+			switch (terms[t].kind) {
+			case Term::Kind::Constant:  return Operand { .kind = Operand::Kind::Constant, .value = terms[t].value };
+			case Term::Kind::Parameter: return Operand { .kind = Operand::Kind::Parameter, .value = terms[t].value };
+			case Term::Kind::Symbol:    return Operand { .kind = Operand::Kind::Symbol, .value = terms[t].value, .symbol_prefix = terms[t].symbol_prefix };
+			default:                    return std::nullopt;
+			}
+		};
+		auto const base = [](Address const& a) -> std::optional<Operand> {
+			// Offset becomes displacement of memory operand
+			if (a.scale != 1 || a.offset < std::numeric_limits<std::int32_t>::min() || a.offset > std::numeric_limits<std::int32_t>::max())
+				return std::nullopt;
+			if (a.symbol)
+				return Operand { .kind = Operand::Kind::Symbol, .value = a.symbol->second, .symbol_prefix = a.symbol->first };
+			if (a.parameter)
+				return Operand { .kind = Operand::Kind::Parameter, .value = *a.parameter };
+			return std::nullopt;
+		};
+
+		std::optional<Operand> bound;
+		if (is(condition, Intrinsic_Kind::Less) && terms[condition].inputs[0] == counter)
+			bound = operand(terms[condition].inputs[1]);
+		else if (is(condition, Intrinsic_Kind::Greater) && terms[condition].inputs[1] == counter)
+			bound = operand(terms[condition].inputs[0]);
+		else if (is(condition, Intrinsic_Kind::Not_Equal))
+			bound = operand(terms[condition].inputs[terms[condition].inputs[0] == counter ? 1 : 0]);
+		if (!bound || (is(condition, Intrinsic_Kind::Not_Equal) && !std::count(std::cbegin(terms[condition].inputs), std::cend(terms[condition].inputs), counter)))
+			return std::nullopt;
+
+		auto const& store = tracer.stores.front();
+		auto const destination = base(store.address);
+		if (store.size != 1 || !destination)
+			return std::nullopt;
+
+		Idiom idiom { .kind = Idiom::Kind::Fill, .bound = *bound, .destination = *destination, .destination_offset = store.address.offset };
+		if (condition_loads == 0 && tracer.load_sizes.empty()) {
+			auto const value = operand(store.value);
+			if (!value || value->kind == Operand::Kind::Symbol)
+				return std::nullopt;
+			idiom.value = *value;
+			return idiom;
+		}
+
+		auto const& loaded = terms[store.value];
+		if (condition_loads != 0 || tracer.load_sizes.size() != 1 || loaded.kind != Term::Kind::Load || loaded.value != 1)
+			return std::nullopt;
+		auto const a = tracer.address(loaded.inputs[0]);
+		auto const source = a ? base(*a) : std::nullopt;
+		if (!source)
+			return std::nullopt;
+		idiom.kind = Idiom::Kind::Copy;
+		idiom.source = *source;
+		idiom.source_offset = a->offset;
+		return idiom;
+	}
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "stacky.hh"
+
+// Counted loops over `[]byte` and `[]u32` arrays that process one element per iteration,
+// like `while dup N < do dup A + load8 1 + over B + swap store8 1 + end`, described as
+// expressions over vector lanes, so that backend can process several elements at once.
+// Loop that was described stays as it is and handles elements that remain.
+// Loops computing length of string, comparing strings, filling or copying arrays of bytes
+// are recognized as idioms, that backend replaces with string instructions or vector scans.
+namespace vectorizer
+{
+	// Value computed in every lane. Comparisons and boolean operations produce masks
+	// (all bits set for true), other values are lane sized parts of values of scalar loop.
+	struct Node
+	{
+		enum class Kind
+		{
+			Constant,  // value is broadcast to all lanes
+			Parameter, // value on the stack below counter, `value` is its depth (counter is at 0)
+			Load,      // `value` with `symbol_prefix` is array, element is `counter * element size + offset` bytes into it
+			Intrinsic, // shifts keep amount in `value` and mask clearing bits shifted in from other byte as second input
+			Select,    // inputs are mask, value where it is set, value where it is not
+		};
+
+		Kind kind;
+		Intrinsic_Kind intrinsic{};
+		std::uint64_t value = 0;
+		std::string_view symbol_prefix = {};
+		std::int64_t offset = 0;
+		std::vector<unsigned> inputs = {};
+	};
+
+	struct Store
+	{
+		std::uint64_t symbol;
+		std::string_view symbol_prefix;
+		std::int64_t offset;
+		unsigned value;
+	};
+
+	// Value on the stack at given depth that has sum of `value` over all iterations added to it
+	struct Reduction
+	{
+		unsigned depth;
+		unsigned value;
+	};
+
+	struct Loop
+	{
+		std::vector<Node> nodes; // in order of evaluation
+		std::vector<Store> stores;
+		std::vector<Reduction> reductions;
+
+		unsigned element_size; // 1 or 4 bytes
+		unsigned lanes;        // elements processed at once
+		std::uint64_t bound;   // counter goes up to it
+	};
+
+	constexpr unsigned Max_Nodes = 10;
+	constexpr unsigned Max_Reductions = 2;
+
+	// Value that loop replaced by idiom gets from outside of it
+	struct Operand
+	{
+		enum class Kind
+		{
+			Constant,
+			Parameter, // `value` is depth on the stack
+			Symbol,
+		};
+
+		Kind kind;
+		std::uint64_t value = 0;
+		std::string_view symbol_prefix = {};
+	};
+
+	// Loops that do the same as string instructions or scans of memory, which backend emits instead of them,
+	// leaving stack as the loop would before its final check of condition. Pointers and counters are on
+	// top of the stack (and below it in case of compare).
+	struct Idiom
+	{
+		enum class Kind
+		{
+			Length,  // while dup load8 0 != do 1 + end
+			Compare, // while 2dup load8 swap load8 = over load8 0 = ! and do 1 + swap 1 + swap end
+			Fill,    // while dup N < do dup A + V store8 1 + end
+			Copy,    // while dup N < do dup A + load8 over B + swap store8 1 + end
+		};
+
+		Kind kind;
+		Operand bound{};           // counter goes up to it
+		Operand value{};           // stored by fill
+		Operand destination{}, source{};
+		std::int64_t destination_offset = 0, source_offset = 0;
+	};
+
+	// Loop starting with `while` at given index, when it is counted loop `while dup N < do ... 1 + end`
+	// (or with `!=`) whose body can be evaluated for several elements at once
+	auto analyze(std::vector<Operation> const& body, unsigned while_op) -> std::optional<Loop>;
+
+	// Loop starting with `while` at given index, when it is one of idioms
+	auto recognize_idiom(std::vector<Operation> const& body, unsigned while_op) -> std::optional<Idiom>;
+}